@@ -0,0 +1,623 @@
+/**
+ * @file benchmark.cpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <ChunkedDecoder/ChunkedDecoder.hpp>
+#include <DataDecoder/DataDecoder.hpp>
+#include <DecoderPool/DecoderPool.hpp>
+#include <SignalGenerator/SignalGenerator.hpp>
+#include <Tools/SampleFormat.hpp>
+#include <Tools/SampleInput.hpp>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+static constexpr uint8_t RAW_DATA_SAMPLES_PER_BIT{10U};
+
+/// Amount of samples in each synthetic input
+static constexpr size_t INPUT_SAMPLES_NO{1000000U};
+
+/// Every measurement is repeated and the best result is reported (the least disturbed by the system)
+static constexpr size_t REPETITIONS_NO{5U};
+
+/// Amount of time frame stage calls measured at once
+static constexpr size_t FRAME_STAGE_CALLS_NO{100000U};
+
+/// Minimum amount of samples decoded during end to end measurement (recording is decoded repeatedly)
+static constexpr size_t END_TO_END_MIN_SAMPLES_NO{10000000U};
+
+/// Amount of frames (an hour) of noisy synthetic signal decoding with tracking is checked against
+static constexpr size_t TRACKING_CHECK_FRAMES_NO{1200U};
+
+/// Amount of decoder pool channels fed concurrently (each with its own synthetic signal)
+static constexpr size_t POOL_CHANNELS_NO{8U};
+
+/// Amount of decoder pool worker threads
+static constexpr size_t POOL_THREADS_NO{4U};
+
+/// Amount of frames (10 minutes) of every decoder pool channel's signal
+static constexpr size_t POOL_CHANNEL_FRAMES_NO{200U};
+
+/// Amount of samples pushed to the decoder pool channel at once (not aligned with pool's blocks on purpose)
+static constexpr size_t POOL_PUSH_SAMPLES_NO{3000U};
+
+/// Amount of frames (15 minutes) of the signal decoded in chunks
+static constexpr size_t CHUNKED_CHECK_FRAMES_NO{300U};
+
+/// Amount of chunks decoded by every chunked decoder thread
+static constexpr size_t CHUNKED_CHECK_CHUNKS_PER_THREAD{4U};
+
+/// Amounts of chunked decoder threads compared with the single decoder
+static constexpr std::array<size_t, 3U> CHUNKED_CHECK_THREADS_NO{1U, 3U, 8U};
+
+/// Stream buffer size of the decoder instantiated outside of DataDecoder.cpp (enough for up to 2 samples per bit)
+static constexpr uint16_t SMALL_STREAM_SIZE{256U};
+
+/// Samples per bit of the signal decoded with the small stream buffer
+static constexpr uint8_t SMALL_STREAM_SAMPLES_PER_BIT{2U};
+
+/// Amount of frames (10 minutes) of the signal decoded with the small stream buffer
+static constexpr size_t SMALL_STREAM_FRAMES_NO{200U};
+
+namespace eczas {
+
+/// @brief Access to decoder internals for time frame processing stages measurements
+class DataDecoderBenchmark {
+public:
+  explicit DataDecoderBenchmark(const DataDecoder::TimeFrame& timeFrame) : _timeFrame(PackedTimeFrame::fromBytes(timeFrame)) {}
+
+  bool correctTimeFrameErrorsWithRsFec() {
+    _decoder._timeFrame = _timeFrame;
+    return (not _decoder.correctTimeFrameErrorsWithRsFec().has_value());
+  }
+
+  bool correctSk1ErrorWithCrc() {
+    _decoder._timeFrame = _timeFrame;
+    return _decoder.correctSk1ErrorWithCrc();
+  }
+
+  uint32_t extractTimeData() {
+    _decoder._timeFrame = _timeFrame;
+    _decoder.extractTimeData();
+    return _decoder._timeData.utcTimestamp;
+  }
+
+  /// @brief Get the time frame as left by the last processing stage
+  DataDecoder::TimeFrame getProcessedTimeFrame() const {
+    return _decoder._timeFrame.toBytes();
+  }
+
+  /// @brief Get the time frame as it would be passed to time data extraction
+  DataDecoder::TimeFrame getDescrambledTimeFrame() {
+    _decoder._timeFrame = _timeFrame;
+    _decoder.descrambleTimeMessage();
+    return _decoder._timeFrame.toBytes();
+  }
+
+private:
+  DataDecoder _decoder{RAW_DATA_SAMPLES_PER_BIT};
+
+  const PackedTimeFrame _timeFrame;
+};
+
+}  // namespace eczas
+
+/**
+ * @brief Measure the best (out of REPETITIONS_NO) duration of an operation
+ *
+ * @param operation The operation
+ * @return double Duration in nanoseconds
+ */
+template <typename Operation>
+double measureNs(Operation operation) {
+  double bestNs{0.0};
+
+  for (size_t repetitionNo{0U}; repetitionNo < REPETITIONS_NO; repetitionNo++) {
+    const auto start{std::chrono::steady_clock::now()};
+    operation();
+    const auto end{std::chrono::steady_clock::now()};
+
+    const auto durationNs{std::chrono::duration<double, std::nano>(end - start).count()};
+    if ((repetitionNo == 0U) or (durationNs < bestNs)) {
+      bestNs = durationNs;
+    }
+  }
+
+  return bestNs;
+}
+
+/**
+ * @brief Measure time frame processing stage cost
+ *
+ * @param benchmark Benchmarked decoder with the time frame
+ * @param stage Stage called on the decoder
+ * @return double Duration of the single call in nanoseconds
+ */
+template <typename Stage>
+double measureFrameStageNs(eczas::DataDecoderBenchmark& benchmark, Stage stage) {
+  size_t resultsSum{0U};
+
+  const auto durationNs{measureNs([&]() {
+    for (size_t callNo{0U}; callNo < FRAME_STAGE_CALLS_NO; callNo++) {
+      resultsSum += static_cast<size_t>(stage(benchmark));
+    }
+  })};
+
+  // use the results so the calls can't be optimized out
+  volatile auto resultsSink{resultsSum};
+  static_cast<void>(resultsSink);
+
+  return (durationNs / FRAME_STAGE_CALLS_NO);
+}
+
+/**
+ * @brief Measure per sample cost of processNewSample() and processSamples()
+ *
+ * @param name Input name
+ * @param samples Input samples
+ * @param isLast Input is the last one reported
+ */
+void benchmarkInput(const char* name, const std::vector<int16_t>& samples, bool isLast) {
+  eczas::DataDecoder sampleDecoder{RAW_DATA_SAMPLES_PER_BIT};
+  eczas::DataDecoder blockDecoder{RAW_DATA_SAMPLES_PER_BIT};
+  uint32_t timeFramesNo{0U};
+
+  const auto sampleNs{measureNs([&]() {
+    for (const auto sample : samples) {
+      sampleDecoder.processNewSample(sample);
+    }
+  })};
+
+  const auto blockNs{measureNs([&]() { timeFramesNo = blockDecoder.processSamples(samples.data(), samples.size()).timeFramesNo; })};
+
+  printf("    \"%s\": {\"samples\": %zu, \"time_frames\": %u, \"process_new_sample_ns_per_sample\": %.3f, \"process_samples_ns_per_sample\": %.3f}%s\n", name,
+         samples.size(), timeFramesNo, sampleNs / samples.size(), blockNs / samples.size(), isLast ? "" : ",");
+}
+
+/**
+ * @brief Decode noisy synthetic signal with and without tracking (acquisition only) and compare decoded time frames
+ *
+ * @param name Signal name
+ * @param config Signal parameters
+ * @param isLast Signal is the last one reported
+ * @return true Tracking missed time frame decoded without it
+ * @return false Tracking decoded all the time frames
+ */
+bool checkTracking(const char* name, const eczas::SignalGenerator::Config& config, bool isLast) {
+  std::vector<int16_t> samples(TRACKING_CHECK_FRAMES_NO * eczas::DataDecoder::FRAME_PERIOD_BITS * config.samplesPerBit);
+  eczas::SignalGenerator signalGenerator{config};
+  signalGenerator.generate(samples.data(), samples.size());
+
+  const auto decodeTimestamps{[&](bool trackingEnabled) {
+    std::vector<uint32_t> timestamps{};
+    eczas::DataDecoder decoder{config.samplesPerBit};
+    decoder.setTracking(trackingEnabled);
+    decoder.registerTimeDataCallback(
+      [&](std::pair<const eczas::DataDecoder::TimeData&, uint64_t> timeDataDetails) { timestamps.push_back(timeDataDetails.first.utcTimestamp); });
+    decoder.processSamples(samples.data(), samples.size());
+    std::sort(timestamps.begin(), timestamps.end());
+    return timestamps;
+  }};
+
+  const auto acquisitionTimestamps{decodeTimestamps(false)};
+  const auto trackingTimestamps{decodeTimestamps(true)};
+
+  std::vector<uint32_t> missedTimestamps{};
+  std::set_difference(acquisitionTimestamps.begin(), acquisitionTimestamps.end(), trackingTimestamps.begin(), trackingTimestamps.end(),
+                      std::back_inserter(missedTimestamps));
+
+  printf("    \"%s\": {\"samples\": %zu, \"acquisition_time_frames\": %zu, \"tracking_time_frames\": %zu, \"missed_time_frames\": %zu}%s\n", name,
+         samples.size(), acquisitionTimestamps.size(), trackingTimestamps.size(), missedTimestamps.size(), isLast ? "" : ",");
+
+  return (not missedTimestamps.empty());
+}
+
+/**
+ * @brief Decode synthetic signals with decoder pool channels fed concurrently and compare them with decoding by standalone decoders
+ *
+ * @return true Time data reported by any of the channels doesn't match (or samples were lost)
+ * @return false All the channels decoded the same time data (and frame start sample numbers) as standalone decoders
+ */
+bool checkDecoderPool() {
+  using TimeDataRecords = std::vector<std::pair<uint64_t, uint32_t>>;  // frame start sample no and its timestamp
+
+  std::vector<std::vector<int16_t>> signals(POOL_CHANNELS_NO);
+  std::vector<TimeDataRecords> expectedRecords(POOL_CHANNELS_NO);
+
+  for (size_t channelNo{0U}; channelNo < POOL_CHANNELS_NO; channelNo++) {
+    eczas::SignalGenerator::Config config{};
+    config.samplesPerBit = RAW_DATA_SAMPLES_PER_BIT;
+    config.noiseAmplitude = 10000;
+    config.timeFramesPeriod = 1U;
+    config.utcUnixTimestamp += static_cast<uint32_t>(channelNo * 86400U);
+    config.seed = static_cast<uint32_t>(channelNo + 1U);
+
+    auto& signal{signals[channelNo]};
+    signal.resize(POOL_CHANNEL_FRAMES_NO * eczas::DataDecoder::FRAME_PERIOD_BITS * RAW_DATA_SAMPLES_PER_BIT);
+    eczas::SignalGenerator signalGenerator{config};
+    signalGenerator.generate(signal.data(), signal.size());
+
+    eczas::DataDecoder decoder{RAW_DATA_SAMPLES_PER_BIT};
+    decoder.registerTimeDataCallback([&](std::pair<const eczas::DataDecoder::TimeData&, uint64_t> timeDataDetails) {
+      expectedRecords[channelNo].push_back({timeDataDetails.second, timeDataDetails.first.utcTimestamp});
+    });
+    decoder.processSamples(signal.data(), signal.size());
+  }
+
+  std::vector<TimeDataRecords> records(POOL_CHANNELS_NO);
+  std::vector<eczas::DecoderPool::ChannelId> channelIds(POOL_CHANNELS_NO);
+  bool samplesDropped{false};
+
+  const auto start{std::chrono::steady_clock::now()};
+  {
+    eczas::DecoderPool pool{POOL_THREADS_NO};
+
+    // callbacks of the channel are never called concurrently so every channel has its own records
+    for (size_t channelNo{0U}; channelNo < POOL_CHANNELS_NO; channelNo++) {
+      channelIds[channelNo] = pool.addChannel(RAW_DATA_SAMPLES_PER_BIT);
+      pool.getDecoder(channelIds[channelNo]).registerTimeDataCallback([&records, channelNo](std::pair<const eczas::DataDecoder::TimeData&, uint64_t> timeDataDetails) {
+        records[channelNo].push_back({timeDataDetails.second, timeDataDetails.first.utcTimestamp});
+      });
+    }
+
+    // every channel is fed by its own thread
+    std::vector<std::thread> producers{};
+    std::vector<char> producerSamplesDropped(POOL_CHANNELS_NO, 0);
+    for (size_t channelNo{0U}; channelNo < POOL_CHANNELS_NO; channelNo++) {
+      producers.emplace_back([&, channelNo]() {
+        const auto& signal{signals[channelNo]};
+        for (size_t sampleNo{0U}; sampleNo < signal.size(); sampleNo += POOL_PUSH_SAMPLES_NO) {
+          const auto samplesNo{std::min(POOL_PUSH_SAMPLES_NO, signal.size() - sampleNo)};
+          if (pool.pushSamples(channelIds[channelNo], signal.data() + sampleNo, samplesNo)) {
+            producerSamplesDropped[channelNo] = 1;
+          }
+        }
+      });
+    }
+    for (auto& producer : producers) {
+      producer.join();
+    }
+
+    pool.waitIdle();
+
+    for (size_t channelNo{0U}; channelNo < POOL_CHANNELS_NO; channelNo++) {
+      samplesDropped |= ((producerSamplesDropped[channelNo] != 0) or (pool.getProcessingResult(channelIds[channelNo]).samplesNo != signals[channelNo].size()));
+    }
+  }
+  const auto end{std::chrono::steady_clock::now()};
+
+  size_t mismatchedChannelsNo{0U};
+  size_t timeFramesNo{0U};
+  for (size_t channelNo{0U}; channelNo < POOL_CHANNELS_NO; channelNo++) {
+    if (records[channelNo] != expectedRecords[channelNo]) {
+      mismatchedChannelsNo++;
+    }
+    timeFramesNo += records[channelNo].size();
+  }
+
+  const auto samplesNo{POOL_CHANNELS_NO * signals.front().size()};
+  const auto durationNs{std::chrono::duration<double, std::nano>(end - start).count()};
+
+  printf("  \"decoder_pool\": {\"channels\": %zu, \"threads\": %zu, \"samples\": %zu, \"time_frames\": %zu, \"mismatched_channels\": %zu, \"samples_dropped\": %s, \"samples_per_second\": %.0f},\n",
+         POOL_CHANNELS_NO, POOL_THREADS_NO, samplesNo, timeFramesNo, mismatchedChannelsNo, samplesDropped ? "true" : "false", (samplesNo * 1e9) / durationNs);
+
+  return ((mismatchedChannelsNo != 0U) or samplesDropped);
+}
+
+/**
+ * @brief Decode synthetic signal in parallel chunks and compare time data and overruns with decoding by a single decoder
+ * @note Signal of more samples per bit than the stream buffer fits (see DataDecoder::MAX_SAMPLES_PER_BIT) makes the decoder overrun
+ *       at every sync word, so overruns of the samples shared by neighbouring chunks get checked as well.
+ *
+ * @param name Signal name
+ * @param samplesPerBit Samples per bit of the signal
+ * @param isLast Signal is the last one reported
+ * @return true Any of the chunked decodings doesn't match the single decoder
+ * @return false All the chunked decodings reported the same time data and overruns as the single decoder
+ */
+bool checkChunkedDecoder(const char* name, uint8_t samplesPerBit, bool isLast) {
+  using TimeDataRecords = std::vector<std::pair<uint64_t, uint32_t>>;  // frame start sample no and its timestamp
+
+  eczas::SignalGenerator::Config config{};
+  config.samplesPerBit = samplesPerBit;
+  config.noiseAmplitude = 15000;
+  config.timeFramesPeriod = 1U;
+  config.seed = 2U;
+
+  std::vector<int16_t> samples(CHUNKED_CHECK_FRAMES_NO * eczas::DataDecoder::FRAME_PERIOD_BITS * samplesPerBit);
+  eczas::SignalGenerator signalGenerator{config};
+  signalGenerator.generate(samples.data(), samples.size());
+
+  TimeDataRecords expectedRecords{};
+  eczas::DataDecoder decoder{samplesPerBit};
+  decoder.registerTimeDataCallback([&](std::pair<const eczas::DataDecoder::TimeData&, uint64_t> timeDataDetails) {
+    expectedRecords.push_back({timeDataDetails.second, timeDataDetails.first.utcTimestamp});
+  });
+  const auto expectedOverrunsNo{decoder.processSamples(samples.data(), samples.size()).overrunsNo};
+
+  size_t mismatchedDecodingsNo{0U};
+  for (const auto threadsNo : CHUNKED_CHECK_THREADS_NO) {
+    const auto chunksNo{threadsNo * CHUNKED_CHECK_CHUNKS_PER_THREAD};
+    const eczas::ChunkedDecoder chunkedDecoder{samplesPerBit, threadsNo, (samples.size() + chunksNo - 1U) / chunksNo};
+    const auto result{chunkedDecoder.decode(samples.data(), samples.size())};
+
+    TimeDataRecords records{};
+    for (const auto& record : result.timeData) {
+      records.push_back({record.sampleNo, record.timeData.utcTimestamp});
+    }
+
+    if ((records != expectedRecords) or (result.overrunsNo != expectedOverrunsNo)) {
+      mismatchedDecodingsNo++;
+    }
+  }
+
+  printf("    \"%s\": {\"samples_per_bit\": %u, \"samples\": %zu, \"time_frames\": %zu, \"overruns\": %u, \"mismatched_decodings\": %zu}%s\n", name,
+         samplesPerBit, samples.size(), expectedRecords.size(), expectedOverrunsNo, mismatchedDecodingsNo, isLast ? "" : ",");
+
+  return (mismatchedDecodingsNo != 0U);
+}
+
+/**
+ * @brief Convert floating point samples of special values (NaN, infinities, out of full scale) in both float formats
+ *
+ * @return true Any of the samples wasn't converted to its expected value
+ * @return false All the samples were converted as expected
+ */
+bool checkSampleConversion() {
+  static constexpr float NAN_SAMPLE{std::numeric_limits<float>::quiet_NaN()};
+  static constexpr float INF_SAMPLE{std::numeric_limits<float>::infinity()};
+
+  const std::vector<std::pair<float, int16_t>> conversions{{0.0F, 0},        {0.5F, 16383},  {1.0F, INT16_MAX}, {-1.0F, -INT16_MAX}, {2.0F, INT16_MAX},
+                                                           {-2.0F, INT16_MIN}, {NAN_SAMPLE, 0}, {-NAN_SAMPLE, 0}, {INF_SAMPLE, INT16_MAX}, {-INF_SAMPLE, INT16_MIN}};
+
+  // complex samples have the tested value as in-phase component and NaN as quadrature one (which must be ignored)
+  std::vector<uint8_t> float32Input(conversions.size() * sizeof(float));
+  std::vector<uint8_t> complexFloat32Input(conversions.size() * 2U * sizeof(float));
+  for (size_t sampleNo{0U}; sampleNo < conversions.size(); sampleNo++) {
+    memcpy(&float32Input[sampleNo * sizeof(float)], &conversions[sampleNo].first, sizeof(float));
+    memcpy(&complexFloat32Input[sampleNo * 2U * sizeof(float)], &conversions[sampleNo].first, sizeof(float));
+    memcpy(&complexFloat32Input[((sampleNo * 2U) + 1U) * sizeof(float)], &NAN_SAMPLE, sizeof(float));
+  }
+
+  std::vector<int16_t> float32Output(conversions.size());
+  std::vector<int16_t> complexFloat32Output(conversions.size());
+  tools::convertSamples(tools::SampleFormat::Float32, float32Input.data(), conversions.size(), float32Output.data());
+  tools::convertSamples(tools::SampleFormat::ComplexFloat32, complexFloat32Input.data(), conversions.size(), complexFloat32Output.data());
+
+  size_t mismatchedSamplesNo{0U};
+  for (size_t sampleNo{0U}; sampleNo < conversions.size(); sampleNo++) {
+    mismatchedSamplesNo += (float32Output[sampleNo] != conversions[sampleNo].second) ? 1U : 0U;
+    mismatchedSamplesNo += (complexFloat32Output[sampleNo] != conversions[sampleNo].second) ? 1U : 0U;
+  }
+
+  printf("  \"sample_conversion\": {\"samples\": %zu, \"mismatched_samples\": %zu},\n", 2U * conversions.size(), mismatchedSamplesNo);
+
+  return (mismatchedSamplesNo != 0U);
+}
+
+/**
+ * @brief Decode synthetic signal with the decoder of the given stream buffer
+ *
+ * @tparam StreamSize Size of the stream buffer
+ * @tparam Storage What is kept in the stream buffer for every sample
+ * @param samples Signal samples
+ * @return std::vector<std::pair<uint64_t, uint32_t>> Frame start sample no and timestamp of every time data decoded
+ */
+template <uint16_t StreamSize, eczas::DataDecoderBase::StreamStorage Storage>
+std::vector<std::pair<uint64_t, uint32_t>> decodeTimeDataRecords(const std::vector<int16_t>& samples) {
+  std::vector<std::pair<uint64_t, uint32_t>> records{};
+  eczas::BasicDataDecoder<StreamSize, Storage> decoder{SMALL_STREAM_SAMPLES_PER_BIT};
+  decoder.registerTimeDataCallback([&](std::pair<const eczas::DataDecoder::TimeData&, uint64_t> timeDataDetails) {
+    records.push_back({timeDataDetails.second, timeDataDetails.first.utcTimestamp});
+  });
+  decoder.processSamples(samples.data(), samples.size());
+  return records;
+}
+
+/**
+ * @brief Decode synthetic signal with decoders of the small stream buffer (instantiated here) and compare them with the default decoder
+ *
+ * @return true Time data decoded with the small stream buffer doesn't match (or nothing was decoded)
+ * @return false Decoders of the small stream buffer decoded the same time data as the default decoder
+ */
+bool checkSmallStream() {
+  eczas::SignalGenerator::Config config{};
+  config.samplesPerBit = SMALL_STREAM_SAMPLES_PER_BIT;
+  config.noiseAmplitude = 10000;
+  config.timeFramesPeriod = 1U;
+
+  std::vector<int16_t> samples(SMALL_STREAM_FRAMES_NO * eczas::DataDecoder::FRAME_PERIOD_BITS * SMALL_STREAM_SAMPLES_PER_BIT);
+  eczas::SignalGenerator signalGenerator{config};
+  signalGenerator.generate(samples.data(), samples.size());
+
+  const auto expectedRecords{decodeTimeDataRecords<eczas::DataDecoder::STREAM_SIZE, eczas::DataDecoder::STREAM_STORAGE>(samples)};
+  const auto fullRecords{decodeTimeDataRecords<SMALL_STREAM_SIZE, eczas::DataDecoderBase::StreamStorage::Full>(samples)};
+  const auto compactRecords{decodeTimeDataRecords<SMALL_STREAM_SIZE, eczas::DataDecoderBase::StreamStorage::Compact>(samples)};
+
+  const auto fullMismatch{fullRecords != expectedRecords};
+  const auto compactMismatch{compactRecords != expectedRecords};
+
+  printf("  \"small_stream\": {\"stream_size\": %u, \"samples_per_bit\": %u, \"samples\": %zu, \"time_frames\": %zu, \"full_mismatch\": %s, \"compact_mismatch\": %s},\n",
+         SMALL_STREAM_SIZE, SMALL_STREAM_SAMPLES_PER_BIT, samples.size(), expectedRecords.size(), fullMismatch ? "true" : "false", compactMismatch ? "true" : "false");
+
+  return (expectedRecords.empty() or fullMismatch or compactMismatch);
+}
+
+int main(int argc, char* argv[]) {
+  const char* recordingPath{(argc > 1) ? argv[1] : "data/dump_cropped.raw"};
+
+  tools::SampleInput input{};
+  if (input.openFile(recordingPath)) {
+    fprintf(stderr, "E: Can't open recording %s\n", recordingPath);
+    return 1;
+  }
+
+  const auto recordingGetter{input.getAllSamples()};
+  if ((not recordingGetter.has_value()) or (recordingGetter->samplesNo == 0U)) {
+    fprintf(stderr, "E: Can't read recording %s\n", recordingPath);
+    return 1;
+  }
+
+  const auto recording{recordingGetter.value()};
+
+  // grab the 1st time frame from the recording for time frame stages measurements
+  std::optional<eczas::DataDecoder::TimeFrame> rawTimeFrame{};
+  {
+    eczas::DataDecoder decoder{RAW_DATA_SAMPLES_PER_BIT};
+    decoder.registerRawTimeFrameCallback([&](std::pair<const eczas::DataDecoder::TimeFrame&, uint64_t> frameDetails) {
+      if (not rawTimeFrame.has_value()) {
+        rawTimeFrame = frameDetails.first;
+      }
+    });
+    decoder.processSamples(recording.samples, recording.samplesNo);
+  }
+
+  if (not rawTimeFrame.has_value()) {
+    fprintf(stderr, "E: No time frame found in recording %s\n", recordingPath);
+    return 1;
+  }
+
+  // synthetic inputs: no carrier phase changes, random phase changes and recording looped (frame every 3 seconds)
+  std::mt19937 generator{1U};
+  std::uniform_int_distribution<int16_t> quietDistribution{-(eczas::DataDecoder::STREAM_NOISE_HYSTERESIS / 2), eczas::DataDecoder::STREAM_NOISE_HYSTERESIS / 2};
+  std::uniform_int_distribution<int16_t> noisyDistribution{INT16_MIN, INT16_MAX};
+
+  std::vector<int16_t> quietInput(INPUT_SAMPLES_NO);
+  std::vector<int16_t> noisyInput(INPUT_SAMPLES_NO);
+  std::vector<int16_t> framesInput(INPUT_SAMPLES_NO);
+
+  for (size_t sampleNo{0U}; sampleNo < INPUT_SAMPLES_NO; sampleNo++) {
+    quietInput[sampleNo] = quietDistribution(generator);
+    noisyInput[sampleNo] = noisyDistribution(generator);
+    framesInput[sampleNo] = recording.samples[sampleNo % recording.samplesNo];
+  }
+
+  printf("{\n");
+  printf("  \"samples_per_bit\": %u,\n", RAW_DATA_SAMPLES_PER_BIT);
+  printf("  \"inputs\": {\n");
+  benchmarkInput("quiet", quietInput, false);
+  benchmarkInput("noisy", noisyInput, false);
+  benchmarkInput("frames", framesInput, true);
+  printf("  },\n");
+
+  // time frame stages: error free frame, frame with single symbol error and with 3 symbol errors (2 data and 1 parity symbol)
+  const auto validTimeFrame{rawTimeFrame.value()};
+  auto singleErrorTimeFrame{validTimeFrame};
+  singleErrorTimeFrame[3] ^= 0x02;
+  auto multipleErrorsTimeFrame{singleErrorTimeFrame};
+  multipleErrorsTimeFrame[5] ^= 0x10;
+  multipleErrorsTimeFrame[9] ^= 0x10;
+
+  eczas::DataDecoderBenchmark validFrameBenchmark{validTimeFrame};
+  eczas::DataDecoderBenchmark singleErrorFrameBenchmark{singleErrorTimeFrame};
+  eczas::DataDecoderBenchmark multipleErrorsFrameBenchmark{multipleErrorsTimeFrame};
+
+  auto sk1ErrorTimeFrame{validTimeFrame};
+  sk1ErrorTimeFrame[7] ^= 0x01;
+  eczas::DataDecoderBenchmark sk1ErrorFrameBenchmark{sk1ErrorTimeFrame};
+
+  eczas::DataDecoderBenchmark descrambledFrameBenchmark{validFrameBenchmark.getDescrambledTimeFrame()};
+
+  const auto rsStage{[](eczas::DataDecoderBenchmark& benchmark) { return benchmark.correctTimeFrameErrorsWithRsFec(); }};
+  const auto crcStage{[](eczas::DataDecoderBenchmark& benchmark) { return benchmark.correctSk1ErrorWithCrc(); }};
+  const auto extractStage{[](eczas::DataDecoderBenchmark& benchmark) { return benchmark.extractTimeData(); }};
+
+  printf("  \"time_frame_stages_ns\": {\n");
+  printf("    \"rs_no_errors\": %.3f,\n", measureFrameStageNs(validFrameBenchmark, rsStage));
+  printf("    \"rs_single_error\": %.3f,\n", measureFrameStageNs(singleErrorFrameBenchmark, rsStage));
+  printf("    \"rs_multiple_errors\": %.3f,\n", measureFrameStageNs(multipleErrorsFrameBenchmark, rsStage));
+  printf("    \"crc_no_errors\": %.3f,\n", measureFrameStageNs(validFrameBenchmark, crcStage));
+  printf("    \"crc_sk1_error\": %.3f,\n", measureFrameStageNs(sk1ErrorFrameBenchmark, crcStage));
+  printf("    \"extract_time_data\": %.3f\n", measureFrameStageNs(descrambledFrameBenchmark, extractStage));
+  printf("  },\n");
+
+  // end to end: recording decoded repeatedly by a fresh decoder
+  const auto passesNo{(END_TO_END_MIN_SAMPLES_NO + recording.samplesNo - 1U) / recording.samplesNo};
+  uint32_t timeFramesNo{0U};
+
+  const auto endToEndNs{measureNs([&]() {
+    for (size_t passNo{0U}; passNo < passesNo; passNo++) {
+      eczas::DataDecoder decoder{RAW_DATA_SAMPLES_PER_BIT};
+      timeFramesNo = decoder.processSamples(recording.samples, recording.samplesNo).timeFramesNo;
+    }
+  })};
+
+  const auto endToEndSamplesNo{passesNo * recording.samplesNo};
+
+  printf("  \"end_to_end\": {\"recording\": \"%s\", \"samples\": %zu, \"time_frames\": %u, \"ns_per_sample\": %.3f, \"samples_per_second\": %.0f},\n", recordingPath,
+         recording.samplesNo, timeFramesNo, endToEndNs / endToEndSamplesNo, (endToEndSamplesNo * 1e9) / endToEndNs);
+
+  // tracking must not lose any time frame decoded with acquisition only (noise levels and seeds the lock used to lose frames at)
+  eczas::SignalGenerator::Config noisySignalConfig{};
+  noisySignalConfig.samplesPerBit = RAW_DATA_SAMPLES_PER_BIT;
+  noisySignalConfig.timeFramesPeriod = 1U;
+  noisySignalConfig.seed = 3U;
+
+  auto driftingNoisySignalConfig{noisySignalConfig};
+  driftingNoisySignalConfig.noiseAmplitude = 16000;
+  driftingNoisySignalConfig.clockDriftPpm = 40;
+
+  auto veryNoisySignalConfig{noisySignalConfig};
+  veryNoisySignalConfig.noiseAmplitude = 18000;
+
+  const auto decoderPoolMismatch{checkDecoderPool()};
+  const auto smallStreamMismatch{checkSmallStream()};
+  const auto sampleConversionMismatch{checkSampleConversion()};
+
+  printf("  \"chunked\": {\n");
+  auto chunkedDecoderMismatch{checkChunkedDecoder("frames", RAW_DATA_SAMPLES_PER_BIT, false)};
+  chunkedDecoderMismatch |= checkChunkedDecoder("overruns", eczas::DataDecoder::MAX_SAMPLES_PER_BIT + 1U, true);
+  printf("  },\n");
+
+  printf("  \"tracking\": {\n");
+  auto trackingMissedTimeFrames{checkTracking("noisy_drifting", driftingNoisySignalConfig, false)};
+  trackingMissedTimeFrames |= checkTracking("very_noisy", veryNoisySignalConfig, true);
+  printf("  }\n");
+  printf("}\n");
+
+  if (trackingMissedTimeFrames) {
+    fprintf(stderr, "E: Tracking missed time frames decoded with acquisition only\n");
+    return 1;
+  }
+
+  if (decoderPoolMismatch) {
+    fprintf(stderr, "E: Decoder pool channels don't match standalone decoders\n");
+    return 1;
+  }
+
+  if (chunkedDecoderMismatch) {
+    fprintf(stderr, "E: Chunked decoding doesn't match single decoder\n");
+    return 1;
+  }
+
+  if (sampleConversionMismatch) {
+    fprintf(stderr, "E: Floating point samples of special values were converted wrongly\n");
+    return 1;
+  }
+
+  if (smallStreamMismatch) {
+    fprintf(stderr, "E: Decoders of %u samples stream buffer don't match the default decoder\n", SMALL_STREAM_SIZE);
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file generator.cpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <SignalGenerator/SignalGenerator.hpp>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+
+/// Amount of samples generated and written at once
+static constexpr size_t BLOCK_SAMPLES_NO{65536U};
+
+/// Signal bit rate (samples per second is samples per bit times bit rate)
+static constexpr uint32_t BITS_PER_SECOND{50U};
+
+void printUsage(const char* appName) {
+  fprintf(stderr, "\nUsage: %s [-s samplesPerBit] [-a amplitude] [-n noise] [-d driftPpm] [-t seconds] [-T timestamp] [-p period] [-r seed]\n", appName);
+  fprintf(stderr, "  -s samplesPerBit  amount of samples per signal bit (default: 10)\n");
+  fprintf(stderr, "  -a amplitude      phase change pulse amplitude (default: 30000)\n");
+  fprintf(stderr, "  -n noise          peak noise amplitude (default: 0)\n");
+  fprintf(stderr, "  -d driftPpm       sampling clock offset in ppm (default: 0)\n");
+  fprintf(stderr, "  -t seconds        signal duration (default: 3600)\n");
+  fprintf(stderr, "  -T timestamp      UTC unix timestamp of the 1st frame (default: beginning of the year 2000)\n");
+  fprintf(stderr, "  -p period         every n-th frame is a time frame (default: 20 - once a minute)\n");
+  fprintf(stderr, "  -r seed           noise and random frames data seed (default: 1)\n");
+  fprintf(stderr, "Signal is written to standard output as 16 bit little-endian integer samples.\n");
+}
+
+int main(int argc, char* argv[]) {
+  eczas::SignalGenerator::Config config{};
+  uint32_t seconds{3600U};
+
+  for (auto argNo{1}; argNo < argc; argNo++) {
+    if (((argNo + 1) >= argc) or (argv[argNo][0] != '-') or (strlen(argv[argNo]) != 2U)) {
+      printUsage(argv[0]);
+      return 1;
+    }
+
+    const auto value{strtol(argv[++argNo], nullptr, 10)};
+
+    switch (argv[argNo - 1][1]) {
+      case 's':
+        config.samplesPerBit = static_cast<uint8_t>(value);
+        break;
+      case 'a':
+        config.amplitude = static_cast<int16_t>(value);
+        break;
+      case 'n':
+        config.noiseAmplitude = static_cast<int16_t>(value);
+        break;
+      case 'd':
+        config.clockDriftPpm = static_cast<int32_t>(value);
+        break;
+      case 't':
+        seconds = static_cast<uint32_t>(value);
+        break;
+      case 'T':
+        config.utcUnixTimestamp = static_cast<uint32_t>(value);
+        break;
+      case 'p':
+        config.timeFramesPeriod = static_cast<uint16_t>(value);
+        break;
+      case 'r':
+        config.seed = static_cast<uint32_t>(value);
+        break;
+      default:
+        printUsage(argv[0]);
+        return 1;
+    }
+  }
+
+  if (config.samplesPerBit == 0U) {
+    printUsage(argv[0]);
+    return 1;
+  }
+
+  eczas::SignalGenerator generator{config};
+  std::array<int16_t, BLOCK_SAMPLES_NO> block{};
+
+  const auto samplesNo{static_cast<uint64_t>(seconds) * BITS_PER_SECOND * config.samplesPerBit};
+
+  while (generator.getGeneratedSamplesNo() < samplesNo) {
+    const auto leftSamplesNo{samplesNo - generator.getGeneratedSamplesNo()};
+    const auto blockSamplesNo{(leftSamplesNo < BLOCK_SAMPLES_NO) ? static_cast<size_t>(leftSamplesNo) : BLOCK_SAMPLES_NO};
+
+    generator.generate(block.data(), blockSamplesNo);
+    if (fwrite(block.data(), sizeof(int16_t), blockSamplesNo, stdout) != blockSamplesNo) {
+      // output closed
+      return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file ChunkedDecoder.hpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <DataDecoder/DataDecoder.hpp>
+
+#include <stdint.h>
+#include <cstddef>
+#include <vector>
+
+namespace eczas {
+
+/// @brief Parallel decoder of complete recordings split into overlapping chunks
+class ChunkedDecoder {
+public:
+  /// @brief Decoded time data with the recording's sample number of its time frame start
+  struct TimeDataRecord {
+    DataDecoder::TimeData timeData;  ///< Time data
+    uint64_t sampleNo;               ///< Time frame start sample no (counted from the recording start)
+  };
+
+  /// @brief Summary of the recording decoding
+  struct Result {
+    std::vector<TimeDataRecord> timeData;  ///< Decoded time data in sample number order
+    uint32_t overrunsNo;                   ///< Number of samples after which decoders' internal buffers were full (counted by the chunk the sample belongs to)
+  };
+
+  /**
+   * @brief Constructor
+   *
+   * @param streamSamplesPerBit Amount of samples per signal bit
+   * @param threadsNo Amount of worker threads (at least one is used)
+   * @param chunkSamplesNo Amount of samples in a chunk (excluding overlap with the next one)
+   * @param phaseDiversity Time frame extraction across sampling phases used by chunk decoders (see DataDecoder::setPhaseDiversity())
+   */
+  ChunkedDecoder(uint8_t streamSamplesPerBit, size_t threadsNo, size_t chunkSamplesNo, DataDecoder::PhaseDiversity phaseDiversity = DataDecoder::PhaseDiversity::Off);
+
+  /// @brief Default destructor
+  ~ChunkedDecoder() = default;
+
+  /**
+   * @brief Get amount of samples a chunk overlaps the next one
+   * @note Any time frame starting within the chunk is complete within the chunk extended with the overlap
+   *       as decoder never keeps more than its stream buffer of data while waiting for a frame (+ sync word detection window).
+   *
+   * @param streamSamplesPerBit Amount of samples per signal bit
+   * @return size_t Amount of samples
+   */
+  static constexpr size_t getOverlapSamplesNo(uint8_t streamSamplesPerBit) {
+    return (static_cast<size_t>(DataDecoder::STREAM_SIZE) + (static_cast<size_t>(DataDecoder::SYNC_WORD_BITS_NO) * streamSamplesPerBit));
+  }
+
+  /**
+   * @brief Get amount of samples decoded before the chunk start (taken from the previous chunk)
+   * @note Decoder locks on the signal within the lead-in the way stream decoder does, so time frames decoded from the chunk
+   *       are the ones a stream decoder finds there (time frames found within the lead-in are reported by the previous chunk).
+   *
+   * @param streamSamplesPerBit Amount of samples per signal bit
+   * @return size_t Amount of samples
+   */
+  static constexpr size_t getLeadInSamplesNo(uint8_t streamSamplesPerBit) {
+    return ((static_cast<size_t>(DataDecoder::TRACKING_LOCK_SYNC_WORDS_NO) * DataDecoder::FRAME_PERIOD_BITS * streamSamplesPerBit) +
+            getOverlapSamplesNo(streamSamplesPerBit));
+  }
+
+  /**
+   * @brief Decode complete recording
+   * @note Every chunk is decoded with its own decoder (starting with the lead-in). Time frames are reported by the chunk they start in,
+   *       so the ones found in the lead-in and overlap regions are not duplicated.
+   *
+   * @param samples Pointer to the first sample of the recording
+   * @param samplesNo Amount of samples in the recording
+   * @return Result Decoding summary
+   */
+  Result decode(const int16_t* samples, size_t samplesNo) const;
+
+private:
+  uint8_t _streamSamplesPerBit;
+
+  size_t _threadsNo;
+
+  size_t _chunkSamplesNo;
+
+  DataDecoder::PhaseDiversity _phaseDiversity;
+};
+
+}  // namespace eczas
@@ -0,0 +1,93 @@
+/**
+ * @file Crc8.hpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <array>
+
+namespace eczas {
+
+namespace crc8 {
+
+/// @brief Amount of distinct byte values
+inline constexpr size_t TABLE_SIZE{UINT8_MAX + 1U};
+
+/// @brief CRC register update for every byte value (MSb first, not reflected)
+template <uint8_t Polynomial>
+inline constexpr std::array<uint8_t, TABLE_SIZE> TABLE{[]() {
+  std::array<uint8_t, TABLE_SIZE> table{};
+  for (size_t byte{0U}; byte < TABLE_SIZE; byte++) {
+    auto crc{static_cast<uint8_t>(byte)};
+    for (uint8_t bitNo{0U}; bitNo < 8U; bitNo++) {
+      crc = static_cast<uint8_t>((crc & 0x80) ? ((crc << 1U) ^ Polynomial) : (crc << 1U));
+    }
+    table[byte] = crc;
+  }
+  return table;
+}()};
+
+/**
+ * @brief Calculate CRC8 over the data
+ *
+ * @tparam Polynomial CRC8 polynomial
+ * @param data Data pointer
+ * @param dataSize Data size in bytes
+ * @param initValue CRC register initialization value
+ * @return constexpr uint8_t CRC8 of the data
+ */
+template <uint8_t Polynomial>
+constexpr uint8_t calculate(const uint8_t* data, size_t dataSize, uint8_t initValue) {
+  auto crc{initValue};
+  for (size_t byteNo{0U}; byteNo < dataSize; byteNo++) {
+    crc = TABLE<Polynomial>[crc ^ data[byteNo]];
+  }
+  return crc;
+}
+
+/**
+ * @brief Calculate CRC8 over the data packed into an integer
+ *
+ * @tparam Polynomial CRC8 polynomial
+ * @param data Data (bytes are taken from the most significant one, the last byte being the integer's LSB)
+ * @param dataSize Data size in bytes (up to 8)
+ * @param initValue CRC register initialization value
+ * @return constexpr uint8_t CRC8 of the data
+ */
+template <uint8_t Polynomial>
+constexpr uint8_t calculate(uint64_t data, uint8_t dataSize, uint8_t initValue) {
+  auto crc{initValue};
+  for (auto byteNo{dataSize}; byteNo > 0U; byteNo--) {
+    crc = TABLE<Polynomial>[crc ^ static_cast<uint8_t>(data >> ((byteNo - 1U) * 8U))];
+  }
+  return crc;
+}
+
+/**
+ * @brief Calculate CRC8 change caused by flipping given bits of the data
+ *
+ * CRC is linear so CRC(data ^ errorPattern) == CRC(data) ^ signature(errorPattern) for any initialization value.
+ * Any bit flip hypothesis is then checked with a single XOR against its precalculated signature.
+ *
+ * @tparam Polynomial CRC8 polynomial
+ * @tparam DataSize Data size in bytes
+ * @param errorPattern Bits flipped in the data
+ * @return constexpr uint8_t Error pattern signature
+ */
+template <uint8_t Polynomial, size_t DataSize>
+constexpr uint8_t calculateErrorSignature(const std::array<uint8_t, DataSize>& errorPattern) {
+  return calculate<Polynomial>(errorPattern.data(), DataSize, 0x00);
+}
+
+}  // namespace crc8
+
+}  // namespace eczas
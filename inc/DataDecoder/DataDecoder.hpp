@@ -11,28 +11,58 @@
 
 #pragma once
 
+#include <DataDecoder/PackedTimeFrame.hpp>
+#include <DataDecoder/SampleClassifier.hpp>
+#include <DataDecoder/Tracing.hpp>
 #include <ReedSolomon/ReedSolomon.hpp>
 
 #include <functional>
 #include <stdint.h>
 #include <array>
+#include <atomic>
+#include <cstddef>
 #include <optional>
 #include <tuple>
 
 namespace eczas {
 
-/// @brief eCzasPL time data decoder
-class DataDecoder {
+/// @brief eCzasPL time data decoder definitions and time frame processing not depending on the stream buffer (see BasicDataDecoder)
+class DataDecoderBase {
 public:
-  /// @brief Size of the stream buffer
-  static constexpr uint16_t STREAM_SIZE{1024U};  // should cover at least one complete frame + at least 2*streamSamplesPerBit (to properly detect frame start)
+  /// @brief Default size of the stream buffer (covers a complete time frame for up to 10 samples per bit)
+  static constexpr uint16_t DEFAULT_STREAM_SIZE{1024U};
 
-  /// @brief Last index number in stream buffer
-  static constexpr uint16_t LAST_STREAM_INDEX{STREAM_SIZE - 1U};
+  /// @brief What is kept in the stream buffer for every sample
+  enum class StreamStorage : uint8_t {
+    Full = 0U,  ///< Sample properties bits and 8 bit significance decision confidence (time frames are recovered with soft decisions as well)
+    Compact,    ///< Sample properties bits only (time frames are recovered with hard decisions only)
+  };
+
+  /// @brief Samples per bit value selecting implementation with bit spacing known only at runtime
+  static constexpr uint8_t GENERIC_SAMPLES_PER_BIT{0U};
+
+  /// @brief Amount of samples classified at once during block processing
+  static constexpr size_t CLASSIFICATION_BLOCK_SIZE{256U};
 
   /// @brief +/- region to treat stream sample value as noise
   static constexpr uint16_t STREAM_NOISE_HYSTERESIS{15000};
 
+  /// @brief Scaling (right shift) of the sample value distance from the noise hysteresis into 8 bit decision confidence
+  static constexpr uint8_t SAMPLE_CONFIDENCE_SHIFT{6U};
+
+  /// @brief Amount of the least confident bit decisions toggled when retrying time frame recovery (2^n candidate frames - Chase algorithm)
+  static constexpr uint8_t SOFT_DECISION_TOGGLED_BITS_NO{4U};
+
+  /// @brief Time frame extraction across sampling phases of the bit period (centered around the phase sync word was correlated at)
+  enum class PhaseDiversity : uint8_t {
+    Off = 0U,   ///< Time frame is read at the sampling phase sync word was correlated at
+    Selection,  ///< Time frame is read at the sampling phase with the best margin (the most bits with decisions matching neighbouring phases)
+    Voting      ///< As Selection but every bit decision is a majority vote of the phase and its neighbouring ones
+  };
+
+  /// @brief Maximum samples per bit phase diversity works with (every phase and its neighbours are read from the stream as a single bitmap word)
+  static constexpr uint8_t PHASE_DIVERSITY_MAX_SAMPLES_PER_BIT{SampleClassifier::SAMPLES_PER_WORD - 2U};
+
   /// @brief Data frame synchronization word
   static constexpr uint16_t SYNC_WORD{0x5555};  // arbitrary value
 
@@ -42,21 +72,61 @@ public:
   /// @brief Initial value to correclty retrieve frame data from stream
   static constexpr bool FRAME_DATA_READ_START_PRECONDITION{true};
 
+  /// @brief Phase changes (significant stream samples) expected for consecutive bits of the sync word (bit value changes with every phase change)
+  static constexpr uint16_t SYNC_WORD_PHASE_CHANGES{static_cast<uint16_t>(SYNC_WORD ^ ((SYNC_WORD >> 1U) | (FRAME_DATA_READ_START_PRECONDITION ? 0x8000 : 0x0000)))};
+
+  static_assert(SYNC_WORD_BITS_NO == 16U, "Sync word phase changes history is kept in 16 bit registers");
+
+  /// @brief Data frames transmission period in bits (frames start every 3 seconds)
+  static constexpr uint16_t FRAME_PERIOD_BITS{150U};
+
+  /// @brief Amount of time frame candidates following the frame cadence required to lock on the signal (enter tracking mode)
+  static constexpr uint8_t TRACKING_LOCK_SYNC_WORDS_NO{3U};
+
+  /// @brief Amount of consecutive sync words missing at predicted positions after which the lock is lost (acquisition mode)
+  static constexpr uint8_t TRACKING_MISSED_SYNC_WORDS_NO{5U};
+
+  /// @brief Tolerance of the predicted sync word position in bits (covers transmitter timing corrections and sampling clock drift)
+  static constexpr uint8_t TRACKING_WINDOW_BITS{4U};
+
   /// @brief Time frame lenght in bytes
   static constexpr uint8_t TIME_FRAME_BYTES_NO{12U};  // arbitrary value
 
+  /// @brief Time frame lenght in bits
+  static constexpr uint8_t TIME_FRAME_BITS_NO{TIME_FRAME_BYTES_NO * 8U};
+
+  static_assert(TIME_FRAME_BYTES_NO == PackedTimeFrame::BYTES_NO, "Time frame is processed packed into 96 bits");
+
+  /// @brief Bits kept in the stream buffer besides the time frame (bit before the frame start and the phase the frame is read at)
+  static constexpr uint8_t FRAME_START_MARGIN_BITS_NO{2U};
+
+  /// @brief Bits of the stream buffer needed for a time frame to be extracted from it (stream buffer spans them for every sample per bit)
+  static constexpr uint8_t STREAM_FRAME_BITS_NO{TIME_FRAME_BITS_NO + FRAME_START_MARGIN_BITS_NO};
+
   /// @brief Time frame start byte
   static constexpr uint8_t TIME_FRAME_START_BYTE{0x60};
 
   /// @brief Time message static prefix
   static constexpr uint8_t TIME_MESSAGE_PREFIX{0x05};
 
+  /// @brief Time message (time frame bytes 3-7) scrambling word
+  static constexpr std::array<uint8_t, 5U> SCRAMBLING_WORD{0x0A, 0x47, 0x55, 0x4D, 0x2B};
+
   /// @brief CRC8 polynomial
   static constexpr uint8_t CRC8_POLYNOMIAL{0x07};
 
   /// @brief CRC8 initialization value
   static constexpr uint8_t CRC8_INIT_VALUE{0x00};
 
+  /// @brief First time frame byte covered by CRC8
+  static constexpr uint8_t CRC8_DATA_FIRST_BYTE{3U};
+
+  /// @brief Amount of time frame bytes covered by CRC8
+  static constexpr uint8_t CRC8_DATA_BYTES_NO{5U};
+
+  /// @brief Time frame byte holding CRC8
+  static constexpr uint8_t CRC8_BYTE{11U};
+
   /// @brief Time zone offset to UTC in hours
   enum class TimeZoneOffset : uint8_t {
     OffsetPlus0h = 0U,  ///< No offset
@@ -91,33 +161,88 @@ public:
     TransmitterState transmitterState;  ///< Transmitter state
   };
 
+  /// @brief Summary of processing a block of samples
+  struct ProcessingResult {
+    size_t samplesNo;       ///< Number of processed samples
+    uint32_t overrunsNo;    ///< Number of samples after which internal buffer was full (new data gets lost)
+    uint32_t timeFramesNo;  ///< Number of successfully decoded time frames
+  };
+
   /// @brief Time frame data container
   using TimeFrame = std::array<uint8_t, TIME_FRAME_BYTES_NO>;
 
   /// @brief Time data reception callback (time data, frame start sample no)
-  using TimeDataCallback = std::function<void(std::pair<const TimeData&, uint32_t>)>;
+  using TimeDataCallback = std::function<void(std::pair<const TimeData&, uint64_t>)>;
 
   /// @brief Time frame reception callback (time frame, frame start sample no)
-  using TimeFrameCallback = std::function<void(std::pair<const TimeFrame&, uint32_t>)>;
+  using TimeFrameCallback = std::function<void(std::pair<const TimeFrame&, uint64_t>)>;
 
   /// @brief Time frame processing error callback (error)
   using TimeFrameProcessingErrorCallback = std::function<void(TimeFrameProcessingError)>;
 
+  /**
+   * @brief Time frame processing events sink ignoring all the events
+   * @note Custom sink (processSamples() template parameter) derives from it and defines handlers of interest only (hiding the empty ones).
+   *       Handlers are called directly on the sink type (no virtual calls) so they get inlined and the empty ones compile away.
+   */
+  struct NullSink {
+    /// @brief Raw time frame extracted from the stream (time frame, frame start sample no)
+    void onRawTimeFrame(const TimeFrame&, uint64_t) {}
+
+    /// @brief Time frame with Reed-Solomon corrected time data (time frame, frame start sample no)
+    void onRsProcessedTimeFrame(const TimeFrame&, uint64_t) {}
+
+    /// @brief Time frame with CRC corrected SK1 bit (time frame, frame start sample no)
+    void onCrcProcessedTimeFrame(const TimeFrame&, uint64_t) {}
+
+    /// @brief Time data decoded (time data, frame start sample no)
+    void onTimeData(const TimeData&, uint64_t) {}
+
+    /// @brief Time frame processing error (error)
+    void onTimeFrameProcessingError(TimeFrameProcessingError) {}
+  };
+
   /// RS(15,9) -> 15 symbols in codeword, 9 symbols of data -> 4bit symbol -> 3 correctable symbols
   using RS = reedsolomon::ReedSolomon<4U, 3U>;
 
-  /// @brief Reed-Solomon code word reception callback
-  using ReedSolomonCodeWordCallback = std::function<void(std::pair<const RS::Codeword&, uint32_t>)>;
+  /// @brief Amount of 4 bit symbols in Reed-Solomon code word
+  static constexpr uint8_t RS_CODEWORD_SYMBOLS_NO{15U};
 
-  /**
-   * @brief Constructor
-   *
-   * @param streamSamplesPerBit Amount of samples per signal bit
-   */
-  explicit DataDecoder(uint8_t streamSamplesPerBit);
+  /// @brief Amount of Reed-Solomon parity symbols (2t)
+  static constexpr uint8_t RS_PARITY_SYMBOLS_NO{6U};
 
-  /// @brief Default destructor
-  ~DataDecoder() = default;
+  /// @brief Power of x of which 1st symbol (S0-S3) is a coefficient in code word polynomial (ECC0 upper symbol is a coefficient of x^0)
+  static constexpr uint8_t RS_FIRST_SYMBOL_POWER{6U};
+
+  /// @brief Time frame bit holding MSb of the 1st Reed-Solomon data symbol (S0)
+  static constexpr uint8_t RS_FIRST_DATA_BIT_NO{PackedTimeFrame::RS_FIRST_DATA_BIT_NO};
+
+  /// @brief Amount of Reed-Solomon data symbols
+  static constexpr uint8_t RS_DATA_SYMBOLS_NO{RS_CODEWORD_SYMBOLS_NO - RS_PARITY_SYMBOLS_NO};
+
+  /// @brief Time frame bit holding MSb of the 1st Reed-Solomon parity symbol (ECC0 upper nibble)
+  static constexpr uint8_t RS_FIRST_PARITY_BIT_NO{PackedTimeFrame::RS_FIRST_PARITY_BIT_NO};
+
+  /// @brief Maximum amount of symbols treated as erasures (remaining parity symbols validate the recovery)
+  static constexpr uint8_t RS_MAX_ERASURES_NO{4U};
+
+  /// @brief Reed-Solomon code word reception callback
+  using ReedSolomonCodeWordCallback = std::function<void(std::pair<const RS::Codeword&, uint64_t>)>;
+
+  /// @brief Decoder statistics (counted since the decoder creation)
+  struct Statistics {
+    uint64_t samplesNo;                 ///< Number of processed samples
+    uint64_t overrunsNo;                ///< Number of samples after which internal buffer was full
+    uint64_t syncWordDetectionsNo;      ///< Number of sync words detected by correlation (time frame candidates)
+    uint64_t staticFieldsRejectionsNo;  ///< Number of time frame candidates rejected by static fields validation
+    std::array<uint64_t, RS_CODEWORD_SYMBOLS_NO + 1U> rsCorrectionsNo;  ///< Number of time frames recovered with Reed-Solomon by number of symbols fixed
+    uint64_t softDecisionRecoveriesNo;  ///< Number of time frames recovered only with soft decisions
+    uint64_t rsFailuresNo;              ///< Number of time frames Reed-Solomon recovery failed for
+    uint64_t sk1RepairsNo;              ///< Number of SK1 bits repaired using CRC
+    uint64_t crcFailuresNo;             ///< Number of time frames CRC validation failed for
+    uint64_t timeFramesNo;              ///< Number of successfully decoded time frames
+    uint16_t backlogSamplesNo;          ///< Number of buffered samples not analyzed yet (meaningful data)
+  };
 
   /**
    * @brief Register time data reception callback
@@ -154,6 +279,222 @@ public:
    */
   void registerTimeFrameProcessingErrorCallback(TimeFrameProcessingErrorCallback callback);
 
+  /**
+   * @brief Get snapshot of decoder statistics
+   * @note May be called from any thread (i.e. monitoring one) while samples are processed.
+   *       Counters are read one by one so they may be slightly out of sync with each other.
+   *
+   * @return Statistics Statistics snapshot
+   */
+  Statistics getStatistics() const;
+
+protected:
+  /// @brief Default constructor (decoder is created as BasicDataDecoder)
+  DataDecoderBase() = default;
+
+  /// @brief Default destructor
+  ~DataDecoderBase() = default;
+
+  /// Sink adapter calling registered callbacks
+  class CallbackSink {
+  public:
+    explicit CallbackSink(const DataDecoderBase& decoder) : _decoder(decoder) {}
+
+    void onRawTimeFrame(const TimeFrame& timeFrame, uint64_t sampleNo) const {
+      if (_decoder._rawTimeFrameCallback) {
+        _decoder._rawTimeFrameCallback({timeFrame, sampleNo});
+      }
+    }
+
+    void onRsProcessedTimeFrame(const TimeFrame& timeFrame, uint64_t sampleNo) const {
+      if (_decoder._rsProcessedTimeFrameCallback) {
+        _decoder._rsProcessedTimeFrameCallback({timeFrame, sampleNo});
+      }
+    }
+
+    void onCrcProcessedTimeFrame(const TimeFrame& timeFrame, uint64_t sampleNo) const {
+      if (_decoder._crcProcessedTimeFrameCallback) {
+        _decoder._crcProcessedTimeFrameCallback({timeFrame, sampleNo});
+      }
+    }
+
+    void onTimeData(const TimeData& timeData, uint64_t sampleNo) const {
+      if (_decoder._timeDataCallback) {
+        _decoder._timeDataCallback({timeData, sampleNo});
+      }
+    }
+
+    void onTimeFrameProcessingError(TimeFrameProcessingError error) const {
+      if (_decoder._timeFrameProcessingErrorCallback) {
+        _decoder._timeFrameProcessingErrorCallback(error);
+      }
+    }
+
+  private:
+    const DataDecoderBase& _decoder;
+  };
+
+  TimeDataCallback _timeDataCallback{nullptr};
+
+  TimeFrameCallback _rawTimeFrameCallback{nullptr};
+
+  TimeFrameCallback _rsProcessedTimeFrameCallback{nullptr};
+
+  TimeFrameCallback _crcProcessedTimeFrameCallback{nullptr};
+
+  TimeFrameProcessingErrorCallback _timeFrameProcessingErrorCallback{nullptr};
+
+  PackedTimeFrame _timeFrame{};  // time frame being processed (unpacked to TimeFrame for notifications only)
+
+  TimeData _timeData{};
+
+  /// Statistics counters (see Statistics) written by the processing thread only and read by any thread
+  struct StatisticsCounters {
+    std::atomic<uint64_t> samplesNo{0U};
+    std::atomic<uint64_t> overrunsNo{0U};
+    std::atomic<uint64_t> syncWordDetectionsNo{0U};
+    std::atomic<uint64_t> staticFieldsRejectionsNo{0U};
+    std::array<std::atomic<uint64_t>, RS_CODEWORD_SYMBOLS_NO + 1U> rsCorrectionsNo{};
+    std::atomic<uint64_t> softDecisionRecoveriesNo{0U};
+    std::atomic<uint64_t> rsFailuresNo{0U};
+    std::atomic<uint64_t> sk1RepairsNo{0U};
+    std::atomic<uint64_t> crcFailuresNo{0U};
+    std::atomic<uint64_t> timeFramesNo{0U};
+    std::atomic<uint16_t> backlogSamplesNo{0U};
+  };
+
+  StatisticsCounters _statistics{};
+
+#ifdef ECZAS_TRACING
+  uint64_t _blockArrivalTimestamp{0U};  // time the currently processed block of samples was passed for processing
+#endif
+
+  /// Reed-Solomon encoder/decoder
+  RS _rs{};
+
+  static void incrementCounter(std::atomic<uint64_t>& counter);
+
+  static uint8_t getSampleConfidence(int16_t sample);
+
+  /// Outcome of time frame extraction from the stream
+  enum class TimeFrameExtraction : uint8_t {
+    Extracted,      // time frame candidate is in _timeFrame and its stream end index in _timeFrameCandidateEndIndex
+    DataMissing,    // not all the time frame data is in the stream yet
+    PrefixMismatch  // time frame static prefix doesn't match (false sync word detection)
+  };
+
+  /// Time frame static prefix (sync word, time frame start byte and time message prefix) checked byte by byte during extraction
+  static constexpr uint8_t TIME_FRAME_PREFIX_BYTES_NO{4U};
+
+  static constexpr std::array<uint8_t, TIME_FRAME_PREFIX_BYTES_NO> TIME_FRAME_PREFIX{static_cast<uint8_t>(SYNC_WORD >> 8U), static_cast<uint8_t>(SYNC_WORD & 0x00FF), TIME_FRAME_START_BYTE, static_cast<uint8_t>(TIME_MESSAGE_PREFIX << 5U)};
+
+  static constexpr std::array<uint8_t, TIME_FRAME_PREFIX_BYTES_NO> TIME_FRAME_PREFIX_MASK{0xFF, 0xFF, 0xFF, 0xE0};
+
+  /// Scrambled time frame bits (time frame bytes 3-7) toggled at once when descrambling
+  static constexpr PackedTimeFrame SCRAMBLING_MASK{PackedTimeFrame::fromBytes(
+    {0x00, 0x00, 0x00, SCRAMBLING_WORD[0], SCRAMBLING_WORD[1], SCRAMBLING_WORD[2], SCRAMBLING_WORD[3], SCRAMBLING_WORD[4], 0x00, 0x00, 0x00, 0x00})};
+
+  bool validateTimeFrameStaticFields();
+
+  std::optional<uint8_t> correctTimeFrameErrorsWithRsFec();
+
+  RS::Codeword getRsCodewordFromTimeFrame() const;
+
+  void updateTimeFrameWithRsCodeword(const RS::Codeword& codeword);
+
+  using RsSyndromes = std::array<uint8_t, RS_PARITY_SYMBOLS_NO>;
+
+  static RsSyndromes calculateRsSyndromes(const RS::Codeword& codeword);
+
+  static bool rsSyndromesIndicateErrors(const RsSyndromes& syndromes);
+
+  static uint8_t countRsSymbolDifferences(const RS::Codeword& codeword, const RS::Codeword& otherCodeword);
+
+  static bool correctSingleRsSymbolError(RS::Codeword& codeword, const RsSyndromes& syndromes);
+
+  using RsErasures = std::array<uint8_t, RS_MAX_ERASURES_NO>;
+
+  static bool correctRsErasures(RS::Codeword& codeword, const RsSyndromes& syndromes, const RsErasures& erasedSymbolIndexes, uint8_t erasuresNo);
+
+  static void findLeastConfident(const uint8_t* confidence, uint8_t itemsNo, uint8_t* indexes, uint8_t indexesNo);
+
+  void descrambleTimeMessage();
+
+  void extractTimeData();
+
+  uint8_t calculateCrcSyndrome() const;
+
+  bool isCrcValid() const;
+
+  bool correctSk1ErrorWithCrc();
+};
+
+/**
+ * @brief eCzasPL time data decoder
+ * @note Stream buffer keeps only properties of the recent samples (being out of noise region and having positive value) as bitmaps
+ *       and the sample no of its oldest entry - sample no of any other entry is derived from it.
+ *       Stream buffer of 256 samples is enough for up to 2 samples per bit, 512 for up to 5 and 1024 for up to 10 samples per bit.
+ *
+ * @tparam StreamSize Size of the stream buffer (power of 2 samples) - must cover complete time frame + 2 bits (see STREAM_FRAME_BITS_NO)
+ * @tparam Storage What is kept in the stream buffer for every sample
+ */
+template <uint16_t StreamSize = DataDecoderBase::DEFAULT_STREAM_SIZE, DataDecoderBase::StreamStorage Storage = DataDecoderBase::StreamStorage::Full>
+class BasicDataDecoder : public DataDecoderBase {
+public:
+  /// @brief Size of the stream buffer
+  static constexpr uint16_t STREAM_SIZE{StreamSize};  // should cover at least one complete frame + at least 2*streamSamplesPerBit (to properly detect frame start)
+
+  /// @brief Last index number in stream buffer
+  static constexpr uint16_t LAST_STREAM_INDEX{STREAM_SIZE - 1U};
+
+  /// @brief Mask wrapping stream buffer positions (stream buffer is circular)
+  static constexpr uint16_t STREAM_POSITION_MASK{STREAM_SIZE - 1U};
+
+  static_assert((STREAM_SIZE != 0U) and ((STREAM_SIZE & STREAM_POSITION_MASK) == 0U), "Stream buffer size must be a power of 2");
+
+  static_assert((STREAM_SIZE % SampleClassifier::SAMPLES_PER_WORD) == 0U, "Stream buffer must consist of complete bitmap words");
+
+  static_assert(STREAM_SIZE >= STREAM_FRAME_BITS_NO, "Stream buffer must cover complete time frame + 2 bits at 1 sample per bit at least");
+
+  /// @brief Stream buffer storage
+  static constexpr StreamStorage STREAM_STORAGE{Storage};
+
+  /// @brief Maximum samples per bit the decoder works with (complete time frame + 2 bits fit the stream buffer)
+  static constexpr uint8_t MAX_SAMPLES_PER_BIT{
+    static_cast<uint8_t>(((STREAM_SIZE / STREAM_FRAME_BITS_NO) < UINT8_MAX) ? (STREAM_SIZE / STREAM_FRAME_BITS_NO) : UINT8_MAX)};
+
+  /**
+   * @brief Constructor
+   * @note Common samples per bit rates (4, 5, 8 and 10) use processing specialized at compile time,
+   *       any other rate is handled by the generic implementation.
+   *
+   * @param streamSamplesPerBit Amount of samples per signal bit
+   */
+  explicit BasicDataDecoder(uint8_t streamSamplesPerBit);
+
+  /// @brief Default destructor
+  ~BasicDataDecoder() = default;
+
+  /**
+   * @brief Set time frame extraction across sampling phases
+   * @note Time frame candidate is read at every phase of the bit period at once (bit-sliced) so the cost is close to reading a single phase.
+   *       Phases not matching time frame static prefix are dropped before the best one is chosen.
+   *
+   * @param phaseDiversity Phase diversity mode
+   * @return true Mode is not supported for the decoder's samples per bit (see PHASE_DIVERSITY_MAX_SAMPLES_PER_BIT)
+   * @return false Mode was set
+   */
+  bool setPhaseDiversity(PhaseDiversity phaseDiversity);
+
+  /**
+   * @brief Enable or disable locking on the signal
+   * @note With tracking disabled sync word is searched for at every sample (acquisition only) - it costs more but it's a reference
+   *       decoding tracking is checked against. Tracking is enabled by default.
+   *
+   * @param trackingEnabled Tracking is enabled
+   */
+  void setTracking(bool trackingEnabled);
+
   /**
    * @brief Process new sample
    * @note Adds sample to internal buffer and calculate sync word correlation.
@@ -165,61 +506,193 @@ public:
    */
   bool processNewSample(int16_t sample);
 
+  /**
+   * @brief Process block of samples
+   * @note Equivalent of calling processNewSample() for every sample in the block but without per sample call overhead.
+   *
+   * @param samples Pointer to the first sample in the block
+   * @param samplesNo Amount of samples in the block
+   * @return ProcessingResult Summary of the whole block processing
+   */
+  ProcessingResult processSamples(const int16_t* samples, size_t samplesNo);
+
+  /**
+   * @brief Process new sample reporting events to the sink
+   *
+   * @tparam Sink Events sink type (see NullSink)
+   * @param sample The sample
+   * @param sink Events sink
+   * @return true Internal buffer got full (new data gets lost)
+   * @return false There is a room for new samples to process
+   */
+  template <typename Sink>
+  bool processNewSample(int16_t sample, Sink& sink);
+
+  /**
+   * @brief Process block of samples reporting events to the sink
+   * @note Registered callbacks are not called - events are reported to the sink only.
+   *
+   * @tparam Sink Events sink type (see NullSink)
+   * @param samples Pointer to the first sample in the block
+   * @param samplesNo Amount of samples in the block
+   * @param sink Events sink
+   * @return ProcessingResult Summary of the whole block processing
+   */
+  template <typename Sink>
+  ProcessingResult processSamples(const int16_t* samples, size_t samplesNo, Sink& sink);
+
 private:
-  std::array<int16_t, STREAM_SIZE> _stream{};
+  /// Benchmark measures time frame processing stages in isolation
+  friend class DataDecoderBenchmark;
 
-  std::array<bool, STREAM_SIZE> _correlator{};
+  /* Stream buffers are circular and share the same positioning.
+     Stream index (0 - oldest data, LAST_STREAM_INDEX - newest data) is translated into buffer position using getStreamPosition(). */
+  using StreamBitmap = std::array<uint64_t, SampleClassifier::getWordsNo(STREAM_SIZE)>;
 
-  std::array<uint32_t, STREAM_SIZE> _sampleNo{};
+  /// Only properties of the samples are meaningful for decoding: being out of noise region and having positive value
+  StreamBitmap _significantSamples{};
 
-  const std::array<uint8_t, 5U> _scramblingWord{0x0A, 0x47, 0x55, 0x4D, 0x2B};
+  StreamBitmap _positiveSamples{};
 
-  TimeDataCallback _timeDataCallback{nullptr};
+  StreamBitmap _correlator{};
 
-  TimeFrameCallback _rawTimeFrameCallback{nullptr};
+  // distance of the sample value from the noise hysteresis (significance decision confidence) - kept with full storage only
+  std::array<uint8_t, ((STREAM_STORAGE == StreamStorage::Full) ? STREAM_SIZE : 0U)> _sampleConfidence{};
 
-  TimeFrameCallback _rsProcessedTimeFrameCallback{nullptr};
+  /// Phase changes histories (one for each sampling phase) rounded up to power of 2 so any sampling phase is wrapped into them
+  static constexpr uint16_t PHASE_CHANGES_HISTORIES_NO{[]() {
+    uint16_t historiesNo{1U};
+    while (historiesNo < MAX_SAMPLES_PER_BIT) {
+      historiesNo = static_cast<uint16_t>(historiesNo << 1U);
+    }
+    return historiesNo;
+  }()};
 
-  TimeFrameCallback _crcProcessedTimeFrameCallback{nullptr};
+  static constexpr uint8_t PHASE_CHANGES_HISTORY_MASK{static_cast<uint8_t>(PHASE_CHANGES_HISTORIES_NO - 1U)};
 
-  TimeFrameProcessingErrorCallback _timeFrameProcessingErrorCallback{nullptr};
+  std::array<uint16_t, PHASE_CHANGES_HISTORIES_NO> _phaseChangesHistory{};  // phase changes history (sync word correlation) for each sampling phase
 
   uint8_t _streamSamplesPerBit;
 
+  const uint16_t _syncWordStartIndex;  // stream index of the sync word's MSb sample when its LSb sample is the newest one
+
+  const uint16_t _samplesNoForTimeFrame;  // stream samples spanned by the time frame bits (spaced every _streamSamplesPerBit)
+
+  using ProcessSamplesImplementation = size_t (BasicDataDecoder::*)(const int16_t* samples, size_t samplesNo, ProcessingResult& result);
+
+  const ProcessSamplesImplementation _processSamplesImplementation;  // selected for _streamSamplesPerBit at construction
+
+  uint64_t _streamSampleNo{static_cast<uint64_t>(0U) - STREAM_SIZE};  // sample no of the oldest data (stream index 0) counted from the decoder creation
+
+  bool _syncWordLookup{true};  // when not set a sync word was detected and time frame is going to be extracted once all its data is in the stream
+
+  uint8_t _samplePhase{0U};  // sampling phase of the newest sample (sample no modulo _streamSamplesPerBit)
+
+  uint16_t _streamHead{0U};  // buffer position of the oldest data (stream index 0) which is going to be overwritten next
+
   uint16_t _meaningfulDataStartIndex{STREAM_SIZE};
 
-  DataDecoder::TimeFrame _timeFrame{};
+  std::optional<uint16_t> _timeFrameCandidateEndIndex{};  // set when time frame candidate was extracted from the stream and awaits processing
 
-  TimeData _timeData{};
+  PhaseDiversity _phaseDiversity{PhaseDiversity::Off};
 
-  /// Reed-Solomon encoder/decoder
-  RS _rs{};
+  int8_t _timeFrameCandidatePhaseOffset{0};  // samples from the correlated sync word to the sampling phase time frame candidate was read at
+
+  /* Sync word search runs for every sample until TRACKING_LOCK_SYNC_WORDS_NO time frame candidates (sync words followed by time frame
+     static prefix) are found on the frame cadence (acquisition). Then the decoder is locked on the signal (tracking) and the search is limited
+     to a window around the predicted sync word position. Outside of the window sync word correlation is not calculated at all. */
+  bool _trackingEnabled{true};  // decoder is allowed to lock on the signal
+
+  bool _tracking{false};  // decoder is locked on the signal
+
+  bool _syncWordSearchActive{true};  // sync word correlation is calculated for the newest sample
+
+  bool _syncWordFoundInWindow{false};  // sync word was found within current tracking window
+
+  uint8_t _syncWordsOnCadenceNo{0U};  // amount of sync words found on the frame cadence during acquisition
+
+  uint8_t _missedSyncWordsNo{0U};  // amount of consecutive tracking windows without sync word
 
-  void addNewData(int16_t sample, uint32_t sampleNo);
+  uint64_t _lastSyncWordSampleNo{0U};  // sample no of the last time frame candidate's sync word MSb
 
-  void calculateSyncWordCorrelation();
+  uint64_t _lastCorrelationSampleNo{0U};  // sample no of the last sync word's MSb detected by correlation
+
+  uint64_t _expectedSyncWordSampleNo{0U};  // predicted sample no of the next sync word's MSb (center of the tracking window)
+
+  /// Stream samples classifier
+  SampleClassifier _classifier{STREAM_NOISE_HYSTERESIS};
+
+  static ProcessSamplesImplementation selectProcessSamplesImplementation(uint8_t streamSamplesPerBit);
+
+  template <uint8_t SamplesPerBit>
+  uint8_t getSamplesPerBit() const;
+
+  template <uint8_t SamplesPerBit>
+  size_t processSamplesImplementation(const int16_t* samples, size_t samplesNo, ProcessingResult& result);
+
+  void completeSampleProcessing(ProcessingResult& result);
+
+  void completeTimeFrameCandidateProcessing(bool timeFrameProcessingError, ProcessingResult& result);
+
+  void updateStatistics(const ProcessingResult& result);
+
+  void addNewData(bool sampleSignificant, bool samplePositive, uint8_t sampleConfidence);
+
+  uint16_t getStreamPosition(uint16_t index) const;
+
+  uint64_t getStreamSampleNo(uint16_t index) const;
+
+  static bool getStreamBit(const StreamBitmap& bitmap, uint16_t position);
+
+  static void setStreamBit(StreamBitmap& bitmap, uint16_t position, bool value);
+
+  std::optional<uint16_t> findFirstStreamBit(const StreamBitmap& bitmap, uint16_t startIndex, uint16_t endIndex) const;
+
+  uint64_t getStreamBits(const StreamBitmap& bitmap, uint16_t index, uint8_t bitsNo) const;
+
+  template <uint8_t SamplesPerBit>
+  void calculateSyncWordCorrelation(bool sampleSignificant, bool samplePositive);
+
+  template <uint8_t SamplesPerBit>
+  bool isSyncWordSearchActive();
+
+  template <uint8_t SamplesPerBit>
+  void rebuildPhaseChangesHistory();
+
+  template <uint8_t SamplesPerBit>
+  void trackSyncWord(uint64_t syncWordSampleNo);
 
   bool isSampleValueOutOfNoiseRegion(uint16_t index);
 
   bool syncWordDetectedByCorrelation();
 
-  std::optional<std::tuple<uint8_t, uint16_t, bool>> getByteFromStream(uint16_t startIndex, bool initialBitValueIsOne);
+  template <uint8_t SamplesPerBit>
+  uint64_t getBitsFromStream(uint16_t& bitIndex, bool& bitValueIsOne, uint8_t bitsNo);
 
-  std::optional<uint16_t> getTimeFrameDataFromStream();
+  template <uint8_t SamplesPerBit>
+  TimeFrameExtraction getTimeFrameDataFromStream();
 
-  bool processTimeFrameData();
+  template <uint8_t SamplesPerBit>
+  TimeFrameExtraction getTimeFrameDataFromStreamPhases();
 
-  bool validateTimeFrameStaticFields();
+  template <typename Sink>
+  bool processTimeFrameData(Sink& sink);
 
-  bool correctTimeFrameErrorsWithRsFec();
+  bool correctTimeFrameErrors();
 
-  void descrambleTimeMessage();
+  std::optional<uint8_t> correctTimeFrameErrorsWithSoftDecisions();
+};
 
-  void extractTimeData();
+/// @brief eCzasPL time data decoder with the default stream buffer
+using DataDecoder = BasicDataDecoder<>;
 
-  bool validateCrc();
+// stream buffer sizes used by the applications (default one and the one for up to 5 samples per bit) are compiled once in DataDecoder.cpp,
+// any other size is instantiated where it's used
+extern template class BasicDataDecoder<512U, DataDecoderBase::StreamStorage::Full>;
+extern template class BasicDataDecoder<512U, DataDecoderBase::StreamStorage::Compact>;
+extern template class BasicDataDecoder<1024U, DataDecoderBase::StreamStorage::Full>;
+extern template class BasicDataDecoder<1024U, DataDecoderBase::StreamStorage::Compact>;
 
-  bool correctSk1ErrorWithCrc();
-};
+}  // namespace eczas
 
-}  // namespace eczas
\ No newline at end of file
+#include <DataDecoder/DataDecoder.ipp>
@@ -0,0 +1,879 @@
+/**
+ * @file DataDecoder.ipp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <DataDecoder/DataDecoder.hpp>
+
+#include <stdint.h>
+#include <array>
+#include <atomic>
+#include <optional>
+
+namespace eczas {
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+BasicDataDecoder<StreamSize, Storage>::BasicDataDecoder(uint8_t streamSamplesPerBit)
+  : _streamSamplesPerBit(streamSamplesPerBit),
+    _syncWordStartIndex(static_cast<uint16_t>(LAST_STREAM_INDEX - static_cast<uint16_t>(static_cast<uint16_t>(SYNC_WORD_BITS_NO - 1U) * streamSamplesPerBit))),
+    _samplesNoForTimeFrame(static_cast<uint16_t>(static_cast<uint16_t>(static_cast<uint16_t>(TIME_FRAME_BYTES_NO) * 8U * streamSamplesPerBit) - streamSamplesPerBit)),
+    _processSamplesImplementation(selectProcessSamplesImplementation(streamSamplesPerBit)) {
+  _significantSamples.fill(0U);
+  _positiveSamples.fill(0U);
+  _correlator.fill(0U);
+  _sampleConfidence.fill(0U);
+  _phaseChangesHistory.fill(0U);
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+bool BasicDataDecoder<StreamSize, Storage>::processNewSample(int16_t sample) {
+  const auto result{processSamples(&sample, 1U)};
+
+  return (result.overrunsNo != 0U);
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+template <typename Sink>
+bool BasicDataDecoder<StreamSize, Storage>::processNewSample(int16_t sample, Sink& sink) {
+  const auto result{processSamples(&sample, 1U, sink)};
+
+  return (result.overrunsNo != 0U);
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+DataDecoderBase::ProcessingResult BasicDataDecoder<StreamSize, Storage>::processSamples(const int16_t* samples, size_t samplesNo) {
+  CallbackSink sink{*this};
+
+  return processSamples(samples, samplesNo, sink);
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+template <typename Sink>
+DataDecoderBase::ProcessingResult BasicDataDecoder<StreamSize, Storage>::processSamples(const int16_t* samples, size_t samplesNo, Sink& sink) {
+  ProcessingResult result{};
+
+#ifdef ECZAS_TRACING
+  _blockArrivalTimestamp = tracing::now();
+#endif
+
+  // stream processing stops at every extracted time frame candidate so it gets processed with the sink
+  while (result.samplesNo < samplesNo) {
+    result.samplesNo += (this->*_processSamplesImplementation)(samples + result.samplesNo, samplesNo - result.samplesNo, result);
+
+    if (_timeFrameCandidateEndIndex.has_value()) {
+      completeTimeFrameCandidateProcessing(processTimeFrameData(sink), result);
+    }
+  }
+
+  updateStatistics(result);
+
+  return result;
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+typename BasicDataDecoder<StreamSize, Storage>::ProcessSamplesImplementation BasicDataDecoder<StreamSize, Storage>::selectProcessSamplesImplementation(uint8_t streamSamplesPerBit) {
+  // common rates get implementation with constant bit spacing (stream loops get fully unrolled)
+  switch (streamSamplesPerBit) {
+    case 4U:
+      return &BasicDataDecoder::processSamplesImplementation<4U>;
+    case 5U:
+      return &BasicDataDecoder::processSamplesImplementation<5U>;
+    case 8U:
+      return &BasicDataDecoder::processSamplesImplementation<8U>;
+    case 10U:
+      return &BasicDataDecoder::processSamplesImplementation<10U>;
+    default:
+      return &BasicDataDecoder::processSamplesImplementation<GENERIC_SAMPLES_PER_BIT>;
+  }
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+template <uint8_t SamplesPerBit>
+uint8_t BasicDataDecoder<StreamSize, Storage>::getSamplesPerBit() const {
+  return ((SamplesPerBit == GENERIC_SAMPLES_PER_BIT) ? _streamSamplesPerBit : SamplesPerBit);
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+template <uint8_t SamplesPerBit>
+size_t BasicDataDecoder<StreamSize, Storage>::processSamplesImplementation(const int16_t* samples, size_t samplesNo, ProcessingResult& result) {
+  // samples are classified in blocks (bit n of the bitmap word describes n-th sample of the word)
+  std::array<uint64_t, SampleClassifier::getWordsNo(CLASSIFICATION_BLOCK_SIZE)> significantSamples{};
+  std::array<uint64_t, SampleClassifier::getWordsNo(CLASSIFICATION_BLOCK_SIZE)> positiveSamples{};
+
+  for (size_t blockStart{0U}; blockStart < samplesNo; blockStart += CLASSIFICATION_BLOCK_SIZE) {
+    const auto blockSamplesNo{((samplesNo - blockStart) < CLASSIFICATION_BLOCK_SIZE) ? (samplesNo - blockStart) : CLASSIFICATION_BLOCK_SIZE};
+    _classifier.classify(samples + blockStart, blockSamplesNo, significantSamples.data(), positiveSamples.data());
+
+    for (size_t blockSampleNo{0U}; blockSampleNo < blockSamplesNo; blockSampleNo++) {
+      const auto wordNo{blockSampleNo / SampleClassifier::SAMPLES_PER_WORD};
+      const auto bitNo{blockSampleNo % SampleClassifier::SAMPLES_PER_WORD};
+      const auto sampleSignificant{static_cast<bool>((significantSamples[wordNo] >> bitNo) & 0x01)};
+      const auto samplePositive{static_cast<bool>((positiveSamples[wordNo] >> bitNo) & 0x01)};
+
+      // decision confidence is kept with full stream storage only
+      uint8_t sampleConfidence{0U};
+      if constexpr (STREAM_STORAGE == StreamStorage::Full) {
+        sampleConfidence = getSampleConfidence(samples[blockStart + blockSampleNo]);
+      }
+
+      addNewData(sampleSignificant, samplePositive, sampleConfidence);
+
+      // when locked on the signal correlation is calculated only around predicted sync word position
+      if (isSyncWordSearchActive<SamplesPerBit>()) {
+        calculateSyncWordCorrelation<SamplesPerBit>(sampleSignificant, samplePositive);
+      }
+
+      // false sync word detection is rejected already during extraction so the next correlator hit is tried right away
+      auto timeFrameExtraction{TimeFrameExtraction::PrefixMismatch};
+      while (timeFrameExtraction == TimeFrameExtraction::PrefixMismatch) {
+        timeFrameExtraction = TimeFrameExtraction::DataMissing;
+
+        if (_syncWordLookup and syncWordDetectedByCorrelation()) {
+          incrementCounter(_statistics.syncWordDetectionsNo);
+          _syncWordLookup = false;
+        }
+
+        if (not _syncWordLookup) {
+          timeFrameExtraction = ((_phaseDiversity == PhaseDiversity::Off) ? getTimeFrameDataFromStream<SamplesPerBit>() : getTimeFrameDataFromStreamPhases<SamplesPerBit>());
+        }
+
+        if (timeFrameExtraction == TimeFrameExtraction::PrefixMismatch) {
+          // data doesn't look like the time frame - look for sync word past this one
+          incrementCounter(_statistics.staticFieldsRejectionsNo);
+          _meaningfulDataStartIndex++;
+          _syncWordLookup = true;
+        }
+      }
+
+      if (timeFrameExtraction == TimeFrameExtraction::Extracted) {
+        // only candidates matching time frame static prefix follow the signal cadence (false sync word detections don't)
+        trackSyncWord<SamplesPerBit>(getStreamSampleNo(_meaningfulDataStartIndex));
+
+        // time frame candidate is processed by the caller (with its sink) which then completes this sample processing
+        return (blockStart + blockSampleNo + 1U);
+      }
+
+      completeSampleProcessing(result);
+    }
+  }
+
+  return samplesNo;
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+void BasicDataDecoder<StreamSize, Storage>::completeSampleProcessing(ProcessingResult& result) {
+  // count samples after which buffer was full
+  if (_meaningfulDataStartIndex == 0U) {
+    result.overrunsNo++;
+  }
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+void BasicDataDecoder<StreamSize, Storage>::completeTimeFrameCandidateProcessing(bool timeFrameProcessingError, ProcessingResult& result) {
+  if (timeFrameProcessingError) {
+    // currently extracted frame doesn't look like the one we are looking for - increase _meaningfulDataStartIndex by one
+    _meaningfulDataStartIndex++;
+  } else {
+    // move stream meaningful data index beyond already extracted time frame (to prevent repeated detection)
+    _meaningfulDataStartIndex = _timeFrameCandidateEndIndex.value();
+    result.timeFramesNo++;
+  }
+
+  _timeFrameCandidateEndIndex.reset();
+  _syncWordLookup = true;
+
+  completeSampleProcessing(result);
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+bool BasicDataDecoder<StreamSize, Storage>::setPhaseDiversity(PhaseDiversity phaseDiversity) {
+  static constexpr bool NO_ERROR{false};
+  static constexpr bool AN_ERROR{true};
+
+  if ((phaseDiversity != PhaseDiversity::Off) and (_streamSamplesPerBit > PHASE_DIVERSITY_MAX_SAMPLES_PER_BIT)) {
+    return AN_ERROR;
+  }
+
+  _phaseDiversity = phaseDiversity;
+
+  return NO_ERROR;
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+void BasicDataDecoder<StreamSize, Storage>::setTracking(bool trackingEnabled) {
+  _trackingEnabled = trackingEnabled;
+
+  if (not trackingEnabled) {
+    _tracking = false;
+    _syncWordsOnCadenceNo = 0U;
+  }
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+void BasicDataDecoder<StreamSize, Storage>::updateStatistics(const ProcessingResult& result) {
+  // per sample counters are updated once per block
+  _statistics.samplesNo.store(_statistics.samplesNo.load(std::memory_order_relaxed) + result.samplesNo, std::memory_order_relaxed);
+  _statistics.overrunsNo.store(_statistics.overrunsNo.load(std::memory_order_relaxed) + result.overrunsNo, std::memory_order_relaxed);
+  _statistics.timeFramesNo.store(_statistics.timeFramesNo.load(std::memory_order_relaxed) + result.timeFramesNo, std::memory_order_relaxed);
+  _statistics.backlogSamplesNo.store(static_cast<uint16_t>(STREAM_SIZE - _meaningfulDataStartIndex), std::memory_order_relaxed);
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+void BasicDataDecoder<StreamSize, Storage>::addNewData(bool sampleSignificant, bool samplePositive, uint8_t sampleConfidence) {
+  // the oldest stream entry is overwritten with the new data which becomes the last one (LAST_STREAM_INDEX)
+  const auto newDataPosition{_streamHead};
+  _streamHead = static_cast<uint16_t>((_streamHead + 1U) & STREAM_POSITION_MASK);
+  _streamSampleNo++;
+
+  // add new data
+  setStreamBit(_significantSamples, newDataPosition, sampleSignificant);
+  setStreamBit(_positiveSamples, newDataPosition, samplePositive);
+  setStreamBit(_correlator, newDataPosition, false);
+  if constexpr (STREAM_STORAGE == StreamStorage::Full) {
+    _sampleConfidence[newDataPosition] = sampleConfidence;
+  }
+
+  // update fresh data index
+  if (_meaningfulDataStartIndex) {
+    _meaningfulDataStartIndex--;
+  }
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+uint16_t BasicDataDecoder<StreamSize, Storage>::getStreamPosition(uint16_t index) const {
+  return static_cast<uint16_t>((_streamHead + index) & STREAM_POSITION_MASK);
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+uint64_t BasicDataDecoder<StreamSize, Storage>::getStreamSampleNo(uint16_t index) const {
+  // stream entries are consecutive samples so no sample no has to be stored along with them
+  return (_streamSampleNo + index);
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+bool BasicDataDecoder<StreamSize, Storage>::getStreamBit(const StreamBitmap& bitmap, uint16_t position) {
+  return static_cast<bool>((bitmap[position / SampleClassifier::SAMPLES_PER_WORD] >> (position % SampleClassifier::SAMPLES_PER_WORD)) & 0x01);
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+void BasicDataDecoder<StreamSize, Storage>::setStreamBit(StreamBitmap& bitmap, uint16_t position, bool value) {
+  auto& word{bitmap[position / SampleClassifier::SAMPLES_PER_WORD]};
+  const auto bitNo{position % SampleClassifier::SAMPLES_PER_WORD};
+
+  word = ((word & ~(static_cast<uint64_t>(0x01) << bitNo)) | (static_cast<uint64_t>(value) << bitNo));
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+std::optional<uint16_t> BasicDataDecoder<StreamSize, Storage>::findFirstStreamBit(const StreamBitmap& bitmap, uint16_t startIndex, uint16_t endIndex) const {
+  // bitmap is scanned word by word (the range may start and end in the middle of the word and wrap around the buffer end)
+  auto index{startIndex};
+
+  while (index < endIndex) {
+    const auto position{getStreamPosition(index)};
+    const auto bitNo{static_cast<uint16_t>(position % SampleClassifier::SAMPLES_PER_WORD)};
+    const auto wordBitsNo{static_cast<uint16_t>(SampleClassifier::SAMPLES_PER_WORD - bitNo)};
+    const auto rangeBitsNo{static_cast<uint16_t>(endIndex - index)};
+    const auto bitsNo{(rangeBitsNo < wordBitsNo) ? rangeBitsNo : wordBitsNo};
+
+    auto word{bitmap[position / SampleClassifier::SAMPLES_PER_WORD] >> bitNo};
+    if (bitsNo < SampleClassifier::SAMPLES_PER_WORD) {
+      word &= ((static_cast<uint64_t>(0x01) << bitsNo) - 1U);
+    }
+
+    if (word) {
+      return static_cast<uint16_t>(index + __builtin_ctzll(word));
+    }
+
+    index += bitsNo;
+  }
+
+  return {};
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+uint64_t BasicDataDecoder<StreamSize, Storage>::getStreamBits(const StreamBitmap& bitmap, uint16_t index, uint8_t bitsNo) const {
+  // bits may span two bitmap words (the 2nd one being the 1st bitmap word when the buffer end is crossed)
+  const auto position{getStreamPosition(index)};
+  const auto wordNo{static_cast<uint16_t>(position / SampleClassifier::SAMPLES_PER_WORD)};
+  const auto bitNo{static_cast<uint16_t>(position % SampleClassifier::SAMPLES_PER_WORD)};
+
+  auto bits{bitmap[wordNo] >> bitNo};
+  if ((bitNo + bitsNo) > SampleClassifier::SAMPLES_PER_WORD) {
+    bits |= (bitmap[(wordNo + 1U) % bitmap.size()] << (SampleClassifier::SAMPLES_PER_WORD - bitNo));
+  }
+
+  if (bitsNo < SampleClassifier::SAMPLES_PER_WORD) {
+    bits &= ((static_cast<uint64_t>(0x01) << bitsNo) - 1U);
+  }
+
+  return bits;
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+template <uint8_t SamplesPerBit>
+void BasicDataDecoder<StreamSize, Storage>::calculateSyncWordCorrelation(bool sampleSignificant, bool samplePositive) {
+  /* Calculate correlation against 16 bit sync word 0x5555 (alternating bit values)
+     - LSb of the sync word is the last sample in the stream buffer and should be 1,
+     - sync word bit samples used in calculation are spaced in buffer with _streamSamplesPerBit,
+     - MSb of the sync word is located (15 * _streamSamplesPerBit) bits back with respect to LSb sample,
+     - correlation is placed at sync word's MSb index to ease further localization of the frame start,
+     - carrier phase changes are expected to be cyclic (no value stalling causing stream sample value to be around 0),
+     - stream samples representing sync word bits are expected to have significant values,
+
+     Data frames are separated with some fill-up time so they can start at full second.
+     Before beginning of the sync word stream values are around value 0 (no carrier phase change).
+     Drop in stream's sample value below 0 (and lower hysteresis region) is an indication of the start of bit value 0 transmission.
+     Jump in stream's sample value above 0 (and higher hysteresis region) is an indication of the start of bit value 1 transmission.
+     Each time frame starts with an indication of the bit value 0 being transmitted.
+     In order to detect where sync word 0x5555 lay in the stream a correlation estimate is calculated on each new signal sample recption.
+
+     Samples spaced with _streamSamplesPerBit share the same sampling phase (sample no modulo _streamSamplesPerBit).
+     For each phase a history of significant samples (phase changes) is kept as a shift register, newest sample being its LSb.
+     This way correlation is a single comparison of the history against phase changes expected for the sync word. */
+
+  // samples per bit over MAX_SAMPLES_PER_BIT may share histories between phases (time frame doesn't fit the stream buffer anyway)
+  auto& phaseChangesHistory{_phaseChangesHistory[_samplePhase & PHASE_CHANGES_HISTORY_MASK]};
+  phaseChangesHistory = static_cast<uint16_t>((phaseChangesHistory << 1U) | (sampleSignificant ? 0x0001 : 0x0000));
+
+  // validate potential value of the sync word's LSb and all the phase changes within the sync word
+  const auto correlationDetected{samplePositive and (phaseChangesHistory == SYNC_WORD_PHASE_CHANGES)};
+
+  // store correlation result into the buffer at sync word's start index
+  setStreamBit(_correlator, getStreamPosition(_syncWordStartIndex), correlationDetected);
+  if (correlationDetected) {
+    _lastCorrelationSampleNo = getStreamSampleNo(_syncWordStartIndex);
+  }
+
+  // next sample belongs to the next sampling phase
+  _samplePhase++;
+  if (_samplePhase == getSamplesPerBit<SamplesPerBit>()) {
+    _samplePhase = 0U;
+  }
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+template <uint8_t SamplesPerBit>
+bool BasicDataDecoder<StreamSize, Storage>::isSyncWordSearchActive() {
+  const auto samplesPerBit{getSamplesPerBit<SamplesPerBit>()};
+  const auto windowSamplesNo{static_cast<int32_t>(TRACKING_WINDOW_BITS * samplesPerBit)};
+  const auto framePeriodSamplesNo{static_cast<uint32_t>(FRAME_PERIOD_BITS * samplesPerBit)};
+
+  auto searchActive{true};
+
+  if (_tracking) {
+    // correlation calculated for the newest sample is the one of the sync word starting (SYNC_WORD_BITS_NO - 1) bits earlier
+    const auto syncWordSampleNo{getStreamSampleNo(_syncWordStartIndex)};
+    auto offset{static_cast<int64_t>(syncWordSampleNo - _expectedSyncWordSampleNo)};
+
+    /* Tracking window outcome is known once every time frame candidate found within it was extracted and validated.
+       Time frame is shorter than the frame period so it is the case before the next window may begin (sync word found at the window edge
+       moves the next window by its half) - next sync word position is predicted then. */
+    if (offset >= (static_cast<int64_t>(framePeriodSamplesNo) - (2 * windowSamplesNo))) {
+      if (_syncWordFoundInWindow) {
+        _missedSyncWordsNo = 0U;
+        _expectedSyncWordSampleNo = _lastSyncWordSampleNo + framePeriodSamplesNo;
+      } else {
+        _missedSyncWordsNo++;
+        _expectedSyncWordSampleNo += framePeriodSamplesNo;
+      }
+
+      _syncWordFoundInWindow = false;
+      offset = static_cast<int64_t>(syncWordSampleNo - _expectedSyncWordSampleNo);
+
+      // signal is lost - get back to acquisition
+      if (_missedSyncWordsNo >= TRACKING_MISSED_SYNC_WORDS_NO) {
+        _tracking = false;
+        _syncWordsOnCadenceNo = 0U;
+      }
+    }
+
+    // sync word correlates at few consecutive sampling phases - all of them are kept in case the 1st one turns out to be a false candidate
+    const auto correlatedPhasesPending{(syncWordSampleNo - _lastCorrelationSampleNo) < samplesPerBit};
+
+    searchActive = ((not _tracking) or ((offset >= -windowSamplesNo) and (offset <= windowSamplesNo)) or correlatedPhasesPending);
+  }
+
+  // phase changes history was not updated while search was inactive
+  if (searchActive and (not _syncWordSearchActive)) {
+    rebuildPhaseChangesHistory<SamplesPerBit>();
+  }
+
+  _syncWordSearchActive = searchActive;
+
+  return searchActive;
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+template <uint8_t SamplesPerBit>
+void BasicDataDecoder<StreamSize, Storage>::rebuildPhaseChangesHistory() {
+  const auto samplesPerBit{getSamplesPerBit<SamplesPerBit>()};
+
+  /* Replay sync word long history of significant samples preceding the newest one (which is going to be correlated next).
+     Sampling phases get relabeled starting from 0, only consistency with the phase of the newest sample matters. */
+  const auto historySamplesNo{static_cast<uint16_t>((SYNC_WORD_BITS_NO * samplesPerBit) - 1U)};
+
+  _samplePhase = 0U;
+
+  for (auto index{static_cast<uint16_t>(LAST_STREAM_INDEX - historySamplesNo)}; index < LAST_STREAM_INDEX; index++) {
+    auto& phaseChangesHistory{_phaseChangesHistory[_samplePhase & PHASE_CHANGES_HISTORY_MASK]};
+    phaseChangesHistory = static_cast<uint16_t>((phaseChangesHistory << 1U) | (isSampleValueOutOfNoiseRegion(index) ? 0x0001 : 0x0000));
+
+    _samplePhase++;
+    if (_samplePhase == samplesPerBit) {
+      _samplePhase = 0U;
+    }
+  }
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+template <uint8_t SamplesPerBit>
+void BasicDataDecoder<StreamSize, Storage>::trackSyncWord(uint64_t syncWordSampleNo) {
+  const auto samplesPerBit{getSamplesPerBit<SamplesPerBit>()};
+  const auto windowSamplesNo{static_cast<uint32_t>(TRACKING_WINDOW_BITS * samplesPerBit)};
+  const auto framePeriodSamplesNo{static_cast<uint32_t>(FRAME_PERIOD_BITS * samplesPerBit)};
+
+  if (not _trackingEnabled) {
+    return;
+  }
+
+  const auto distance{syncWordSampleNo - _lastSyncWordSampleNo};
+
+  // sync word correlates at few consecutive samples - only the 1st one is taken into account
+  if (((_syncWordsOnCadenceNo != 0U) or _tracking) and (distance <= windowSamplesNo)) {
+    return;
+  }
+
+  if (_tracking) {
+    // candidates outside of the tracking window are not on the signal cadence
+    const auto offset{static_cast<int64_t>(syncWordSampleNo - _expectedSyncWordSampleNo)};
+    if ((offset >= -static_cast<int64_t>(windowSamplesNo)) and (offset <= static_cast<int64_t>(windowSamplesNo))) {
+      _lastSyncWordSampleNo = syncWordSampleNo;
+      _syncWordFoundInWindow = true;
+    }
+    return;
+  }
+
+  _lastSyncWordSampleNo = syncWordSampleNo;
+
+  // during acquisition sync word is on the cadence when it is found few frame periods after the previous one (some may be missed)
+  const auto periodsNo{(distance + (framePeriodSamplesNo / 2U)) / framePeriodSamplesNo};
+  const auto cadenceOffset{static_cast<int64_t>(distance - (periodsNo * framePeriodSamplesNo))};
+  const auto onCadence{(periodsNo != 0U) and (periodsNo <= TRACKING_MISSED_SYNC_WORDS_NO) and
+                       (static_cast<uint64_t>((cadenceOffset < 0) ? -cadenceOffset : cadenceOffset) <= windowSamplesNo)};
+
+  _syncWordsOnCadenceNo = ((onCadence and (_syncWordsOnCadenceNo != 0U)) ? static_cast<uint8_t>(_syncWordsOnCadenceNo + 1U) : 1U);
+
+  // lock on the signal
+  if (_syncWordsOnCadenceNo >= TRACKING_LOCK_SYNC_WORDS_NO) {
+    _tracking = true;
+    _syncWordFoundInWindow = false;
+    _missedSyncWordsNo = 0U;
+    _expectedSyncWordSampleNo = syncWordSampleNo + framePeriodSamplesNo;
+  }
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+bool BasicDataDecoder<StreamSize, Storage>::isSampleValueOutOfNoiseRegion(uint16_t index) {
+  if (index >= STREAM_SIZE) {
+    // Sample index is out of range
+    return false;
+  }
+
+  return getStreamBit(_significantSamples, getStreamPosition(index));
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+bool BasicDataDecoder<StreamSize, Storage>::syncWordDetectedByCorrelation() {
+  // correlation is calculated for sync word length backwards from newly added sample so for any newly added sample respective correlation is saved 15 bits (spaced every _streamSamplesPerBit) earlier at MSb index
+  const auto startIndexOfNotCalculatedCorrelatorData{static_cast<uint16_t>(_syncWordStartIndex + 1U)};
+
+  // validate if it is worth doing any data analysis
+  if (_meaningfulDataStartIndex >= startIndexOfNotCalculatedCorrelatorData) {
+    return false;
+  }
+
+  // using correlator bitmap find index of the 1st detected sync word presence
+  const auto syncWordStartIndexGetter{findFirstStreamBit(_correlator, _meaningfulDataStartIndex, startIndexOfNotCalculatedCorrelatorData)};
+
+  // if sync word is not detected invalidate all acquired data (where correlation was estimated)
+  if (not syncWordStartIndexGetter.has_value()) {
+    _meaningfulDataStartIndex = startIndexOfNotCalculatedCorrelatorData;
+    return false;
+  }
+
+  // 1st correlation index was found - all the data before syncWordStartIndex is not usable
+  _meaningfulDataStartIndex = syncWordStartIndexGetter.value();
+
+  return true;
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+template <uint8_t SamplesPerBit>
+uint64_t BasicDataDecoder<StreamSize, Storage>::getBitsFromStream(uint16_t& bitIndex, bool& bitValueIsOne, uint8_t bitsNo) {
+  const auto samplesPerBit{getSamplesPerBit<SamplesPerBit>()};
+
+  // caller assures all the bits are in the stream (1st bit is at bitIndex, rest is spaced with samplesPerBit)
+  uint64_t bitsFromStream{0U};
+  for (uint8_t bitNo{0U}; bitNo < bitsNo; bitNo++) {
+    // significant sample value mean there was a signal phase change thus bit value has changed
+    if (isSampleValueOutOfNoiseRegion(bitIndex)) {
+      bitValueIsOne = !bitValueIsOne;
+    }
+
+    // retrieve correct bit value (MSb first)
+    bitsFromStream = ((bitsFromStream << 1U) | (bitValueIsOne ? 0x01 : 0x00));
+
+    // go ahead with next bit
+    bitIndex += samplesPerBit;
+  }
+
+  // bitIndex and bitValueIsOne are starting conditions for next bits retrieval
+  return bitsFromStream;
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+template <uint8_t SamplesPerBit>
+DataDecoderBase::TimeFrameExtraction BasicDataDecoder<StreamSize, Storage>::getTimeFrameDataFromStream() {
+  // check if it is possible to extract required amount of data (last bit is _samplesNoForTimeFrame samples after the 1st one)
+  if (_meaningfulDataStartIndex > (LAST_STREAM_INDEX - _samplesNoForTimeFrame)) {
+    return TimeFrameExtraction::DataMissing;
+  }
+
+  ECZAS_TRACE_SCOPE(GetTimeFrameDataFromStream);
+
+  // retrieve the data
+  uint16_t bitIndex{_meaningfulDataStartIndex};
+  bool bitValueIsOne{FRAME_DATA_READ_START_PRECONDITION};
+  uint64_t head{0U};
+
+  // static prefix is validated on the fly so false sync word detection costs only the bytes read until the 1st mismatch
+#pragma GCC unroll 4
+  for (auto prefixByteNo{0U}; prefixByteNo < TIME_FRAME_PREFIX_BYTES_NO; prefixByteNo++) {
+    const auto prefixByte{static_cast<uint8_t>(getBitsFromStream<SamplesPerBit>(bitIndex, bitValueIsOne, 8U))};
+    if ((prefixByte & TIME_FRAME_PREFIX_MASK[prefixByteNo]) != TIME_FRAME_PREFIX[prefixByteNo]) {
+      return TimeFrameExtraction::PrefixMismatch;
+    }
+
+    head = ((head << 8U) | prefixByte);
+  }
+
+  // remaining bits go straight into the packed time frame
+  static constexpr uint8_t HEAD_REMAINING_BITS_NO{PackedTimeFrame::HEAD_BITS_NO - (TIME_FRAME_PREFIX_BYTES_NO * 8U)};
+  static constexpr uint8_t TAIL_BITS_NO{PackedTimeFrame::BITS_NO - PackedTimeFrame::HEAD_BITS_NO};
+
+  head = ((head << HEAD_REMAINING_BITS_NO) | getBitsFromStream<SamplesPerBit>(bitIndex, bitValueIsOne, HEAD_REMAINING_BITS_NO));
+  const auto tail{static_cast<uint32_t>(getBitsFromStream<SamplesPerBit>(bitIndex, bitValueIsOne, TAIL_BITS_NO))};
+
+  _timeFrame = PackedTimeFrame{head, tail};
+  _timeFrameCandidateEndIndex = bitIndex;
+  _timeFrameCandidatePhaseOffset = 0;
+
+  return TimeFrameExtraction::Extracted;
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+template <uint8_t SamplesPerBit>
+DataDecoderBase::TimeFrameExtraction BasicDataDecoder<StreamSize, Storage>::getTimeFrameDataFromStreamPhases() {
+  const auto samplesPerBit{getSamplesPerBit<SamplesPerBit>()};
+
+  /* Sync word correlates at few consecutive samples of the phase change and the 1st of them may be anywhere within it (depending on noise).
+     Phases are centered around the correlated one and the 1st phase is preceded with its neighbouring sample. */
+  const auto phasesBeforeCorrelatedNo{static_cast<uint8_t>(samplesPerBit / 2U)};
+  if (_meaningfulDataStartIndex <= phasesBeforeCorrelatedNo) {
+    return getTimeFrameDataFromStream<SamplesPerBit>();
+  }
+
+  // the last phase of the last bit is followed by its neighbouring sample
+  const auto windowIndexLimit{static_cast<uint16_t>(_meaningfulDataStartIndex - phasesBeforeCorrelatedNo + (TIME_FRAME_BITS_NO * samplesPerBit))};
+  if (windowIndexLimit > LAST_STREAM_INDEX) {
+    return TimeFrameExtraction::DataMissing;
+  }
+
+  ECZAS_TRACE_SCOPE(GetTimeFrameDataFromStream);
+
+  /* Bit n of every phases word stands for the phase (n - phasesBeforeCorrelatedNo) samples after the correlated one.
+     Significance (and polarity) of all the phases (and their neighbours) of the time frame bit is read from the stream as a single word
+     so every bit operation below is done for all the phases at once. */
+  static constexpr uint8_t MARGIN_COUNTER_BITS_NO{7U};
+  static_assert(TIME_FRAME_BITS_NO < (1U << MARGIN_COUNTER_BITS_NO), "Margin counter must hold amount of all time frame bits");
+  static constexpr uint8_t TIME_FRAME_PREFIX_BITS_NO{TIME_FRAME_PREFIX_BYTES_NO * 8U};
+
+  const auto phasesMask{static_cast<uint64_t>((static_cast<uint64_t>(0x01) << samplesPerBit) - 1U)};
+
+  std::array<uint64_t, TIME_FRAME_BITS_NO> bitValues{};            // time frame bits read at every phase
+  std::array<uint64_t, MARGIN_COUNTER_BITS_NO> marginCounters{};  // counter bit k of every phase is k-th bit of the counter item
+  auto phasesBitValue{FRAME_DATA_READ_START_PRECONDITION ? phasesMask : static_cast<uint64_t>(0U)};
+  auto prefixMatchingPhases{phasesMask};
+  auto windowIndex{static_cast<uint16_t>(_meaningfulDataStartIndex - phasesBeforeCorrelatedNo - 1U)};
+
+  for (uint8_t bitNo{0U}; bitNo < TIME_FRAME_BITS_NO; bitNo++) {
+    // window starts with the sample preceding the 1st phase and ends with the one following the last phase
+    const auto window{getStreamBits(_significantSamples, windowIndex, static_cast<uint8_t>(samplesPerBit + 2U))};
+    const auto previousPhases{window & phasesMask};
+    const auto phases{(window >> 1U) & phasesMask};
+    const auto nextPhases{(window >> 2U) & phasesMask};
+
+    const auto positiveWindow{getStreamBits(_positiveSamples, windowIndex, static_cast<uint8_t>(samplesPerBit + 2U))};
+    const auto previousPositivePhases{positiveWindow & phasesMask};
+    const auto positivePhases{(positiveWindow >> 1U) & phasesMask};
+    const auto nextPositivePhases{(positiveWindow >> 2U) & phasesMask};
+
+    // decision matching both neighbouring phases is far from the bit edge so it adds to the phase margin
+    auto carry{~((previousPhases ^ phases) | (phases ^ nextPhases)) & phasesMask};
+    for (auto& marginCounter : marginCounters) {
+      const auto nextCarry{marginCounter & carry};
+      marginCounter ^= carry;
+      carry = nextCarry;
+    }
+
+    // bit value is taken from the phase change direction (as with soft decisions) so a wrong decision doesn't flip all the following bits
+    auto phaseChanges{phases};
+    auto phaseChangesPositive{positivePhases};
+    if (_phaseDiversity == PhaseDiversity::Voting) {
+      phaseChanges = ((previousPhases & phases) | (previousPhases & nextPhases) | (phases & nextPhases));
+      phaseChangesPositive = ((previousPositivePhases & positivePhases) | (previousPositivePhases & nextPositivePhases) | (positivePhases & nextPositivePhases));
+    }
+    phasesBitValue = ((phasesBitValue & ~phaseChanges) | (phaseChangesPositive & phaseChanges));
+    bitValues[bitNo] = phasesBitValue;
+
+    // phases not matching time frame static prefix are dropped (false sync word detection when none is left)
+    if (bitNo < TIME_FRAME_PREFIX_BITS_NO) {
+      const auto prefixBitMask{static_cast<uint8_t>(0x80 >> (bitNo % 8U))};
+      if (TIME_FRAME_PREFIX_MASK[bitNo / 8U] & prefixBitMask) {
+        prefixMatchingPhases &= ((TIME_FRAME_PREFIX[bitNo / 8U] & prefixBitMask) ? phasesBitValue : ~phasesBitValue);
+        if (not prefixMatchingPhases) {
+          return TimeFrameExtraction::PrefixMismatch;
+        }
+      }
+    }
+
+    windowIndex += samplesPerBit;
+  }
+
+  // find phases with the best margin
+  uint64_t bestPhases{0U};
+  uint8_t bestMargin{0U};
+
+  for (uint8_t phase{0U}; phase < samplesPerBit; phase++) {
+    if (not((prefixMatchingPhases >> phase) & 0x01)) {
+      continue;
+    }
+
+    uint8_t margin{0U};
+    for (uint8_t counterBitNo{0U}; counterBitNo < MARGIN_COUNTER_BITS_NO; counterBitNo++) {
+      margin |= static_cast<uint8_t>(((marginCounters[counterBitNo] >> phase) & 0x01) << counterBitNo);
+    }
+
+    if ((bestPhases == 0U) or (margin > bestMargin)) {
+      bestPhases = 0U;
+      bestMargin = margin;
+    }
+
+    if (margin == bestMargin) {
+      bestPhases |= (static_cast<uint64_t>(0x01) << phase);
+    }
+  }
+
+  // equally good phases are usually the consecutive ones within the phase change - the middle one is the farthest from the bit edges
+  for (auto skippedPhasesNo{__builtin_popcountll(bestPhases) / 2}; skippedPhasesNo > 0; skippedPhasesNo--) {
+    bestPhases &= (bestPhases - 1U);
+  }
+  const auto phase{static_cast<uint8_t>(__builtin_ctzll(bestPhases))};
+
+  uint64_t head{0U};
+  for (uint8_t bitNo{0U}; bitNo < PackedTimeFrame::HEAD_BITS_NO; bitNo++) {
+    head = ((head << 1U) | ((bitValues[bitNo] >> phase) & 0x01));
+  }
+  uint32_t tail{0U};
+  for (uint8_t bitNo{PackedTimeFrame::HEAD_BITS_NO}; bitNo < TIME_FRAME_BITS_NO; bitNo++) {
+    tail = static_cast<uint32_t>((tail << 1U) | ((bitValues[bitNo] >> phase) & 0x01));
+  }
+  _timeFrame = PackedTimeFrame{head, tail};
+
+  // the frame ends where it would when read at the correlated phase
+  _timeFrameCandidateEndIndex = static_cast<uint16_t>(_meaningfulDataStartIndex + (TIME_FRAME_BITS_NO * samplesPerBit));
+  _timeFrameCandidatePhaseOffset = static_cast<int8_t>(phase - phasesBeforeCorrelatedNo);
+
+  return TimeFrameExtraction::Extracted;
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+template <typename Sink>
+bool BasicDataDecoder<StreamSize, Storage>::processTimeFrameData(Sink& sink) {
+  static constexpr bool NO_ERROR{false};
+  static constexpr bool AN_ERROR{true};
+
+  // static fields were already validated during time frame extraction
+  const auto timeFrameSampleNo{getStreamSampleNo(_meaningfulDataStartIndex)};
+
+  // notify raw time frame extracted from the stream
+  sink.onRawTimeFrame(_timeFrame.toBytes(), timeFrameSampleNo);
+
+  if (correctTimeFrameErrors()) {
+    incrementCounter(_statistics.rsFailuresNo);
+    sink.onTimeFrameProcessingError(TimeFrameProcessingError::RsCorrectionFailed);
+    return AN_ERROR;
+  }
+
+  // notify time frame with RS corrected time data
+  sink.onRsProcessedTimeFrame(_timeFrame.toBytes(), timeFrameSampleNo);
+
+  if (correctSk1ErrorWithCrc()) {
+    // TODO: add option to not throw time frame away if transmitter state is not as important
+    incrementCounter(_statistics.crcFailuresNo);
+    sink.onTimeFrameProcessingError(TimeFrameProcessingError::CrcCorrectionFailed);
+    return AN_ERROR;
+  }
+
+  // notify time frame with CRC corrected SK1 bit
+  sink.onCrcProcessedTimeFrame(_timeFrame.toBytes(), timeFrameSampleNo);
+
+  descrambleTimeMessage();
+  extractTimeData();
+
+  // notify time data
+  ECZAS_TRACE_SINCE(SampleToTimeData, _blockArrivalTimestamp);
+  sink.onTimeData(_timeData, timeFrameSampleNo);
+
+  return NO_ERROR;
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+bool BasicDataDecoder<StreamSize, Storage>::correctTimeFrameErrors() {
+  static constexpr bool NO_ERROR{false};
+  static constexpr bool AN_ERROR{true};
+
+  auto fixedSymbolsNo{correctTimeFrameErrorsWithRsFec()};
+
+  // soft decisions are used only when hard ones can't be recovered
+  if (not fixedSymbolsNo.has_value()) {
+    // compact stream storage keeps no decision confidence to base soft decisions on
+    if constexpr (STREAM_STORAGE == StreamStorage::Compact) {
+      return AN_ERROR;
+    }
+
+    fixedSymbolsNo = correctTimeFrameErrorsWithSoftDecisions();
+    if (not fixedSymbolsNo.has_value()) {
+      return AN_ERROR;
+    }
+    incrementCounter(_statistics.softDecisionRecoveriesNo);
+  }
+
+  incrementCounter(_statistics.rsCorrectionsNo[fixedSymbolsNo.value()]);
+
+  return NO_ERROR;
+}
+
+template <uint16_t StreamSize, DataDecoderBase::StreamStorage Storage>
+std::optional<uint8_t> BasicDataDecoder<StreamSize, Storage>::correctTimeFrameErrorsWithSoftDecisions() {
+  static constexpr bool NO_ERROR{false};
+
+  ECZAS_TRACE_SCOPE(CorrectTimeFrameErrorsWithSoftDecisions);
+
+  /* Hard decisions failed to recover the time frame - retry using confidence of significance decisions made for frame bits.
+     Bit value is taken from the sign of significant sample (carrier phase change direction) so wrong decision affects bits only until next phase change.
+     Candidate frames are made by toggling the least confident decisions (Chase algorithm) and each is recovered
+     with the least confident symbols treated as erasures (RS(15,9) recovers up to 6 erasures but only 3 errors). */
+  const auto receivedTimeFrame{_timeFrame};
+  const auto receivedCodeword{getRsCodewordFromTimeFrame()};
+  const auto samplesPerBit{_streamSamplesPerBit};
+
+  // 1. Get significance decisions made for frame bits
+  std::array<bool, TIME_FRAME_BITS_NO> bitSignificant{};
+  std::array<bool, TIME_FRAME_BITS_NO> bitPositive{};
+  std::array<uint8_t, TIME_FRAME_BITS_NO> bitConfidence{};
+
+  for (uint8_t bitNo{0U}; bitNo < TIME_FRAME_BITS_NO; bitNo++) {
+    const auto position{getStreamPosition(static_cast<uint16_t>(_meaningfulDataStartIndex + _timeFrameCandidatePhaseOffset + (bitNo * samplesPerBit)))};
+    bitSignificant[bitNo] = getStreamBit(_significantSamples, position);
+    bitPositive[bitNo] = getStreamBit(_positiveSamples, position);
+    if constexpr (STREAM_STORAGE == StreamStorage::Full) {
+      bitConfidence[bitNo] = _sampleConfidence[position];
+    }
+  }
+
+  // 2. Find the least confident decisions made for bits covered by Reed-Solomon FEC
+  static constexpr uint8_t RS_BITS_NO{static_cast<uint8_t>(RS_FIRST_PARITY_BIT_NO + (RS_PARITY_SYMBOLS_NO * 4U) - RS_FIRST_DATA_BIT_NO)};
+  std::array<uint8_t, SOFT_DECISION_TOGGLED_BITS_NO> toggledBitNos{};
+
+  findLeastConfident(&bitConfidence[RS_FIRST_DATA_BIT_NO], RS_BITS_NO, toggledBitNos.data(), SOFT_DECISION_TOGGLED_BITS_NO);
+  for (auto& toggledBitNo : toggledBitNos) {
+    toggledBitNo += RS_FIRST_DATA_BIT_NO;
+  }
+
+  // 3. Find the least confident symbols (symbol is as confident as its least confident bit)
+  std::array<uint8_t, RS_CODEWORD_SYMBOLS_NO> symbolConfidence{};
+  RsErasures erasedSymbolIndexes{};
+
+  for (uint8_t symbolIndex{0U}; symbolIndex < RS_CODEWORD_SYMBOLS_NO; symbolIndex++) {
+    const auto firstBitNo{static_cast<uint8_t>((symbolIndex < RS_DATA_SYMBOLS_NO) ? (RS_FIRST_DATA_BIT_NO + (symbolIndex * 4U))
+                                                                                   : (RS_FIRST_PARITY_BIT_NO + ((symbolIndex - RS_DATA_SYMBOLS_NO) * 4U)))};
+    symbolConfidence[symbolIndex] = UINT8_MAX;
+    for (auto bitNo{firstBitNo}; bitNo < (firstBitNo + 4U); bitNo++) {
+      if (bitConfidence[bitNo] < symbolConfidence[symbolIndex]) {
+        symbolConfidence[symbolIndex] = bitConfidence[bitNo];
+      }
+    }
+  }
+
+  findLeastConfident(symbolConfidence.data(), RS_CODEWORD_SYMBOLS_NO, erasedSymbolIndexes.data(), RS_MAX_ERASURES_NO);
+
+  // 4. Try to recover candidate frames (1st one has no decisions toggled)
+  for (uint8_t toggledBitsPattern{0U}; toggledBitsPattern < (1U << SOFT_DECISION_TOGGLED_BITS_NO); toggledBitsPattern++) {
+    std::array<bool, TIME_FRAME_BITS_NO> bitToggled{};
+    for (uint8_t toggledBitNo{0U}; toggledBitNo < SOFT_DECISION_TOGGLED_BITS_NO; toggledBitNo++) {
+      bitToggled[toggledBitNos[toggledBitNo]] = static_cast<bool>((toggledBitsPattern >> toggledBitNo) & 0x01);
+    }
+
+    bool bitValueIsOne{FRAME_DATA_READ_START_PRECONDITION};
+    uint64_t head{0U};
+    uint32_t tail{0U};
+
+    for (uint8_t bitNo{0U}; bitNo < TIME_FRAME_BITS_NO; bitNo++) {
+      if (bitSignificant[bitNo] != bitToggled[bitNo]) {
+        // phase change direction defines the bit value (toggled decision has no reliable direction so it just changes the value)
+        bitValueIsOne = (bitToggled[bitNo] ? (not bitValueIsOne) : bitPositive[bitNo]);
+      }
+      if (bitNo < PackedTimeFrame::HEAD_BITS_NO) {
+        head = ((head << 1U) | (bitValueIsOne ? 0x01 : 0x00));
+      } else {
+        tail = static_cast<uint32_t>((tail << 1U) | (bitValueIsOne ? 0x01 : 0x00));
+      }
+    }
+    _timeFrame = PackedTimeFrame{head, tail};
+
+    auto codeword{getRsCodewordFromTimeFrame()};
+    const auto syndromes{calculateRsSyndromes(codeword)};
+    auto recoveryError{rsSyndromesIndicateErrors(syndromes) and correctSingleRsSymbolError(codeword, syndromes)};
+
+    for (uint8_t erasuresNo{1U}; recoveryError and (erasuresNo <= RS_MAX_ERASURES_NO); erasuresNo++) {
+      auto erasuresCorrectedCodeword{codeword};
+      if (not correctRsErasures(erasuresCorrectedCodeword, syndromes, erasedSymbolIndexes, erasuresNo)) {
+        codeword = erasuresCorrectedCodeword;
+        recoveryError = false;
+      }
+    }
+
+    // recovered frame is accepted only when confirmed with CRC8 (SK1 is corrected once by the following pipeline stage)
+    if (not recoveryError) {
+      updateTimeFrameWithRsCodeword(codeword);
+      if ((validateTimeFrameStaticFields() == NO_ERROR) and isCrcValid()) {
+        return countRsSymbolDifferences(receivedCodeword, codeword);
+      }
+    }
+  }
+
+  _timeFrame = receivedTimeFrame;
+
+  return {};
+}
+
+}  // namespace eczas
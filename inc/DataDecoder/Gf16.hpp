@@ -0,0 +1,96 @@
+/**
+ * @file Gf16.hpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <array>
+
+namespace eczas {
+
+namespace gf16 {
+
+/// @brief Primitive polynomial x^4+x+1
+inline constexpr uint8_t PRIMITIVE_POLYNOMIAL{0x13};
+
+/// @brief Amount of non-zero field elements (powers of the primitive element)
+inline constexpr uint8_t ELEMENTS_NO{15U};
+
+/// @brief Field elements being consecutive powers of the primitive element x (antilog table, doubled to skip modulo on multiplication)
+inline constexpr std::array<uint8_t, 2U * ELEMENTS_NO> EXP{[]() {
+  std::array<uint8_t, 2U * ELEMENTS_NO> exp{};
+  uint8_t element{0x01};
+  for (uint8_t power{0U}; power < ELEMENTS_NO; power++) {
+    exp[power] = element;
+    exp[power + ELEMENTS_NO] = element;
+    element <<= 1U;
+    if (element & 0x10) {
+      element ^= PRIMITIVE_POLYNOMIAL;
+    }
+  }
+  return exp;
+}()};
+
+/// @brief Powers of the primitive element for field elements (log table, undefined for 0)
+inline constexpr std::array<uint8_t, ELEMENTS_NO + 1U> LOG{[]() {
+  std::array<uint8_t, ELEMENTS_NO + 1U> log{};
+  for (uint8_t power{0U}; power < ELEMENTS_NO; power++) {
+    log[EXP[power]] = power;
+  }
+  return log;
+}()};
+
+/// @brief Multiplication table
+inline constexpr std::array<std::array<uint8_t, ELEMENTS_NO + 1U>, ELEMENTS_NO + 1U> MUL{[]() {
+  std::array<std::array<uint8_t, ELEMENTS_NO + 1U>, ELEMENTS_NO + 1U> mul{};
+  for (uint8_t a{1U}; a <= ELEMENTS_NO; a++) {
+    for (uint8_t b{1U}; b <= ELEMENTS_NO; b++) {
+      mul[a][b] = EXP[LOG[a] + LOG[b]];
+    }
+  }
+  return mul;
+}()};
+
+/**
+ * @brief Get power of the primitive element
+ *
+ * @param power The power
+ * @return constexpr uint8_t Field element
+ */
+constexpr uint8_t pow(uint16_t power) {
+  return EXP[power % ELEMENTS_NO];
+}
+
+/**
+ * @brief Multiply field elements
+ *
+ * @param a 1st element
+ * @param b 2nd element
+ * @return constexpr uint8_t Product
+ */
+constexpr uint8_t mul(uint8_t a, uint8_t b) {
+  return MUL[a & 0x0F][b & 0x0F];
+}
+
+/**
+ * @brief Divide field elements
+ *
+ * @param a Dividend
+ * @param b Divisor (non-zero)
+ * @return constexpr uint8_t Quotient
+ */
+constexpr uint8_t div(uint8_t a, uint8_t b) {
+  return ((a == 0U) ? 0U : EXP[LOG[a] + ELEMENTS_NO - LOG[b]]);
+}
+
+}  // namespace gf16
+
+}  // namespace eczas
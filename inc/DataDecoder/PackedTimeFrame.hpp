@@ -0,0 +1,235 @@
+/**
+ * @file PackedTimeFrame.hpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <array>
+
+namespace eczas {
+
+/**
+ * @brief Time frame packed into 96 bits
+ * @note Time frame bits are numbered in transmission order (see DataDecoder's README): bits 0-63 are kept in the head (bit 0 being its MSb)
+ *       and bits 64-95 in the tail (bit 95 being its LSb). This way every time frame field is a plain shift and mask of a single word.
+ */
+class PackedTimeFrame {
+public:
+  /// @brief Time frame length in bytes
+  static constexpr uint8_t BYTES_NO{12U};
+
+  /// @brief Time frame length in bits
+  static constexpr uint8_t BITS_NO{BYTES_NO * 8U};
+
+  /// @brief Amount of time frame bits kept in the head
+  static constexpr uint8_t HEAD_BITS_NO{64U};
+
+  /// @brief Time frame as bytes (byte 0 first)
+  using Bytes = std::array<uint8_t, BYTES_NO>;
+
+  /// @brief Time frame field (bits range)
+  struct Field {
+    uint8_t firstBitNo;  ///< Number of the field's MSb
+    uint8_t bitsNo;      ///< Field length in bits (less than 64)
+  };
+
+  /// @brief Frame sync word
+  static constexpr Field SYNC_WORD{0U, 16U};
+
+  /// @brief Time frame start byte
+  static constexpr Field START_BYTE{16U, 8U};
+
+  /// @brief Time message static prefix
+  static constexpr Field TIME_MESSAGE_PREFIX{24U, 3U};
+
+  /// @brief Time frame bytes 3-7 (static prefix and the time message, scrambled and covered by CRC8)
+  static constexpr Field CRC_DATA{24U, 40U};
+
+  /// @brief S0-S29 (3-second periods since 01.01.2000 00:00:00 UTC)
+  static constexpr Field TIMESTAMP{27U, 30U};
+
+  /// @brief TZ0-TZ1 (local time zone)
+  static constexpr Field TIME_ZONE{57U, 2U};
+
+  /// @brief LS (leap second announcement)
+  static constexpr Field LEAP_SECOND_ANNOUNCEMENT{59U, 1U};
+
+  /// @brief LSS (leap second sign)
+  static constexpr Field LEAP_SECOND_SIGN{60U, 1U};
+
+  /// @brief TZC (local time zone change announcement)
+  static constexpr Field TIME_ZONE_CHANGE_ANNOUNCEMENT{61U, 1U};
+
+  /// @brief SK0-SK1 (transmission site operation state)
+  static constexpr Field TRANSMITTER_STATE{62U, 2U};
+
+  /// @brief SK1 (the only time message bit not covered by Reed-Solomon FEC)
+  static constexpr Field SK1{63U, 1U};
+
+  /// @brief ECC0-ECC2 (Reed-Solomon parity symbols)
+  static constexpr Field ECC{64U, 24U};
+
+  /// @brief CRC8 of time frame bytes 3-7
+  static constexpr Field CRC{88U, 8U};
+
+  /// @brief Amount of 4 bit Reed-Solomon symbols (S0-SK0 data followed by ECC0-ECC2 parity)
+  static constexpr uint8_t RS_SYMBOLS_NO{15U};
+
+  /// @brief Amount of Reed-Solomon data symbols
+  static constexpr uint8_t RS_DATA_SYMBOLS_NO{9U};
+
+  /// @brief Time frame bit holding MSb of the 1st Reed-Solomon data symbol (S0)
+  static constexpr uint8_t RS_FIRST_DATA_BIT_NO{TIMESTAMP.firstBitNo};
+
+  /// @brief Time frame bit holding MSb of the 1st Reed-Solomon parity symbol (ECC0 upper nibble)
+  static constexpr uint8_t RS_FIRST_PARITY_BIT_NO{ECC.firstBitNo};
+
+  /// @brief Default constructor (all bits cleared)
+  constexpr PackedTimeFrame() = default;
+
+  /**
+   * @brief Constructor
+   *
+   * @param head Time frame bits 0-63 (bit 0 being the MSb)
+   * @param tail Time frame bits 64-95 (bit 95 being the LSb)
+   */
+  constexpr PackedTimeFrame(uint64_t head, uint32_t tail) : _head(head), _tail(tail) {}
+
+  /**
+   * @brief Pack time frame bytes
+   *
+   * @param bytes Time frame bytes
+   * @return PackedTimeFrame Packed time frame
+   */
+  static constexpr PackedTimeFrame fromBytes(const Bytes& bytes) {
+    uint64_t head{0U};
+    for (uint8_t byteNo{0U}; byteNo < (HEAD_BITS_NO / 8U); byteNo++) {
+      head = ((head << 8U) | bytes[byteNo]);
+    }
+
+    uint32_t tail{0U};
+    for (uint8_t byteNo{HEAD_BITS_NO / 8U}; byteNo < BYTES_NO; byteNo++) {
+      tail = ((tail << 8U) | bytes[byteNo]);
+    }
+
+    return PackedTimeFrame{head, tail};
+  }
+
+  /**
+   * @brief Unpack time frame into bytes
+   *
+   * @return Bytes Time frame bytes
+   */
+  constexpr Bytes toBytes() const {
+    Bytes bytes{};
+    for (uint8_t byteNo{0U}; byteNo < (HEAD_BITS_NO / 8U); byteNo++) {
+      bytes[byteNo] = static_cast<uint8_t>(_head >> (HEAD_BITS_NO - 8U - (byteNo * 8U)));
+    }
+    for (uint8_t byteNo{HEAD_BITS_NO / 8U}; byteNo < BYTES_NO; byteNo++) {
+      bytes[byteNo] = static_cast<uint8_t>(_tail >> (BITS_NO - 8U - (byteNo * 8U)));
+    }
+
+    return bytes;
+  }
+
+  /// @brief Get time frame bits 0-63
+  constexpr uint64_t getHead() const {
+    return _head;
+  }
+
+  /// @brief Get time frame bits 64-95
+  constexpr uint32_t getTail() const {
+    return _tail;
+  }
+
+  /**
+   * @brief Get field value
+   * @note Field must be within the head or within the tail.
+   *
+   * @param field The field
+   * @return uint64_t Field value (field's LSb is the value's LSb)
+   */
+  constexpr uint64_t get(Field field) const {
+    const auto mask{(static_cast<uint64_t>(0x01) << field.bitsNo) - 1U};
+
+    if (field.firstBitNo < HEAD_BITS_NO) {
+      return ((_head >> (HEAD_BITS_NO - field.firstBitNo - field.bitsNo)) & mask);
+    }
+
+    return ((_tail >> (BITS_NO - field.firstBitNo - field.bitsNo)) & mask);
+  }
+
+  /**
+   * @brief Set field value
+   * @note Field must be within the head or within the tail.
+   *
+   * @param field The field
+   * @param value Field value (bits exceeding the field are ignored)
+   */
+  constexpr void set(Field field, uint64_t value) {
+    const auto mask{(static_cast<uint64_t>(0x01) << field.bitsNo) - 1U};
+
+    if (field.firstBitNo < HEAD_BITS_NO) {
+      const auto shift{static_cast<uint8_t>(HEAD_BITS_NO - field.firstBitNo - field.bitsNo)};
+      _head = ((_head & ~(mask << shift)) | ((value & mask) << shift));
+    } else {
+      const auto shift{static_cast<uint8_t>(BITS_NO - field.firstBitNo - field.bitsNo)};
+      _tail = static_cast<uint32_t>((_tail & ~(mask << shift)) | ((value & mask) << shift));
+    }
+  }
+
+  /**
+   * @brief Toggle all the bits set in the mask (i.e. descramble)
+   *
+   * @param mask Time frame with bits to be toggled set
+   */
+  constexpr void toggle(const PackedTimeFrame& mask) {
+    _head ^= mask._head;
+    _tail ^= mask._tail;
+  }
+
+  /**
+   * @brief Get Reed-Solomon symbol field
+   *
+   * @param symbolIndex Symbol index (data symbols S0-SK0 come first, ECC0-ECC2 parity symbols follow)
+   * @return Field The symbol field
+   */
+  static constexpr Field getRsSymbolField(uint8_t symbolIndex) {
+    return {static_cast<uint8_t>((symbolIndex < RS_DATA_SYMBOLS_NO) ? (RS_FIRST_DATA_BIT_NO + (symbolIndex * 4U))
+                                                                    : (RS_FIRST_PARITY_BIT_NO + ((symbolIndex - RS_DATA_SYMBOLS_NO) * 4U))),
+            4U};
+  }
+
+  /// @brief Get Reed-Solomon symbol (see getRsSymbolField())
+  constexpr uint8_t getRsSymbol(uint8_t symbolIndex) const {
+    return static_cast<uint8_t>(get(getRsSymbolField(symbolIndex)));
+  }
+
+  /// @brief Set Reed-Solomon symbol (see getRsSymbolField())
+  constexpr void setRsSymbol(uint8_t symbolIndex, uint8_t value) {
+    set(getRsSymbolField(symbolIndex), value);
+  }
+
+  constexpr bool operator==(const PackedTimeFrame& other) const {
+    return ((_head == other._head) and (_tail == other._tail));
+  }
+
+  constexpr bool operator!=(const PackedTimeFrame& other) const {
+    return not(*this == other);
+  }
+
+private:
+  uint64_t _head{0U};
+
+  uint32_t _tail{0U};
+};
+
+}  // namespace eczas
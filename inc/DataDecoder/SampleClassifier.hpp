@@ -0,0 +1,75 @@
+/**
+ * @file SampleClassifier.hpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <cstddef>
+
+namespace eczas {
+
+/// @brief Converter of stream samples into packed bitmaps of their properties meaningful for decoding
+class SampleClassifier {
+public:
+  /// @brief Amount of samples described by a single bitmap word
+  static constexpr size_t SAMPLES_PER_WORD{64U};
+
+  /**
+   * @brief Get amount of bitmap words needed to describe given amount of samples
+   *
+   * @param samplesNo Amount of samples
+   * @return size_t Amount of bitmap words
+   */
+  static constexpr size_t getWordsNo(size_t samplesNo) {
+    return ((samplesNo + SAMPLES_PER_WORD - 1U) / SAMPLES_PER_WORD);
+  }
+
+  /**
+   * @brief Constructor
+   * @note Selects the fastest classification kernel supported by the CPU (AVX2, SSE2 or scalar).
+   *
+   * @param noiseHysteresis +/- region to treat sample value as noise
+   */
+  explicit SampleClassifier(uint16_t noiseHysteresis);
+
+  /// @brief Default destructor
+  ~SampleClassifier() = default;
+
+  /**
+   * @brief Classify block of samples
+   * @note Bit n of word w describes sample (w * SAMPLES_PER_WORD + n) of the block.
+   *       Bits of the last word beyond the block are cleared.
+   *
+   * @param samples Pointer to the first sample in the block
+   * @param samplesNo Amount of samples in the block
+   * @param significant Bitmap of samples being out of noise region (getWordsNo(samplesNo) words)
+   * @param positive Bitmap of samples having positive value (getWordsNo(samplesNo) words)
+   */
+  void classify(const int16_t* samples, size_t samplesNo, uint64_t* significant, uint64_t* positive) const;
+
+  /**
+   * @brief Get name of the selected classification kernel
+   *
+   * @return const char* Kernel name
+   */
+  const char* getKernelName() const;
+
+private:
+  using Kernel = void (*)(const int16_t* samples, size_t samplesNo, int16_t noiseHysteresis, uint64_t* significant, uint64_t* positive);
+
+  int16_t _noiseHysteresis;
+
+  Kernel _kernel;
+
+  const char* _kernelName;
+};
+
+}  // namespace eczas
@@ -0,0 +1,124 @@
+/**
+ * @file Tracing.hpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+#if defined(ECZAS_TRACING) && defined(ECZAS_TRACING_TSC) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define ECZAS_TRACING_TSC_USED
+#endif
+
+/* Decoding path latency tracing is compiled in with ECZAS_TRACING defined (see `make tracing`).
+   Timings are taken with steady_clock (nanoseconds) or, with ECZAS_TRACING_TSC defined as well, with x86 time stamp counter (cycles).
+   Without ECZAS_TRACING the macros expand to nothing so tracing costs nothing. */
+#ifdef ECZAS_TRACING
+#define ECZAS_TRACE_CONCAT_IMPL(a, b) a##b
+#define ECZAS_TRACE_CONCAT(a, b) ECZAS_TRACE_CONCAT_IMPL(a, b)
+/// Record time spent in the rest of the enclosing scope
+#define ECZAS_TRACE_SCOPE(stage) const ::eczas::tracing::ScopedTimer ECZAS_TRACE_CONCAT(traceScopedTimer, __LINE__){::eczas::tracing::Stage::stage}
+/// Record time elapsed since the timestamp taken with ::eczas::tracing::now()
+#define ECZAS_TRACE_SINCE(stage, timestamp) ::eczas::tracing::record(::eczas::tracing::Stage::stage, ::eczas::tracing::now() - (timestamp))
+#else
+#define ECZAS_TRACE_SCOPE(stage)
+#define ECZAS_TRACE_SINCE(stage, timestamp)
+#endif
+
+namespace eczas {
+namespace tracing {
+
+/// @brief Traced stage of the decoding path
+enum class Stage : uint8_t {
+  GetTimeFrameDataFromStream = 0U,          ///< Time frame extraction from the stream
+  ValidateTimeFrameStaticFields,            ///< Time frame static fields validation
+  CorrectTimeFrameErrorsWithRsFec,          ///< Reed-Solomon recovery of hard decisions
+  CorrectTimeFrameErrorsWithSoftDecisions,  ///< Recovery using soft decisions
+  CorrectSk1ErrorWithCrc,                   ///< SK1 recovery with CRC
+  DescrambleTimeMessage,                    ///< Time message descrambling
+  ExtractTimeData,                          ///< Time data extraction
+  SampleToTimeData,                         ///< Arrival of the samples block with the last time frame sample to time data reporting
+  StagesNo                                  ///< Amount of stages
+};
+
+/// @brief Amount of histogram buckets (n-th bucket counts durations in [2^(n-1), 2^n) range, the last one everything above)
+static constexpr uint8_t HISTOGRAM_BUCKETS_NO{40U};
+
+/// @brief Duration histogram (updated lock-free from any thread)
+struct Histogram {
+  std::atomic<uint64_t> count{0U};
+  std::atomic<uint64_t> sum{0U};
+  std::atomic<uint64_t> min{UINT64_MAX};
+  std::atomic<uint64_t> max{0U};
+  std::array<std::atomic<uint64_t>, HISTOGRAM_BUCKETS_NO> buckets{};
+};
+
+/**
+ * @brief Get current timestamp
+ *
+ * @return uint64_t Timestamp (nanoseconds or time stamp counter cycles)
+ */
+inline uint64_t now() {
+#ifdef ECZAS_TRACING_TSC_USED
+  return __rdtsc();
+#else
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/**
+ * @brief Record stage duration
+ *
+ * @param stage The stage
+ * @param duration Duration (nanoseconds or time stamp counter cycles)
+ */
+void record(Stage stage, uint64_t duration);
+
+/**
+ * @brief Get stage histogram
+ *
+ * @param stage The stage
+ * @return const Histogram& The histogram
+ */
+const Histogram& getHistogram(Stage stage);
+
+/**
+ * @brief Write all stage histograms as text
+ * @note Async-signal-safe (no allocations nor locks) so it may be called from a signal handler.
+ *
+ * @param fd File descriptor to write to
+ */
+void dump(int fd);
+
+/// @brief Records duration of its lifetime
+class ScopedTimer {
+public:
+  explicit ScopedTimer(Stage stage) : _stage(stage), _start(now()) {}
+
+  ~ScopedTimer() {
+    record(_stage, now() - _start);
+  }
+
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+  const Stage _stage;
+
+  const uint64_t _start;
+};
+
+}  // namespace tracing
+}  // namespace eczas
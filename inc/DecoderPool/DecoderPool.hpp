@@ -0,0 +1,161 @@
+/**
+ * @file DecoderPool.hpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <DataDecoder/DataDecoder.hpp>
+#include <Tools/SpscQueue.hpp>
+
+#include <stdint.h>
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eczas {
+
+/**
+ * @brief Pool of independent data decoders (channels) run on a shared set of worker threads
+ * @note Every channel has its own lock-free samples queue and lock so producers of different channels never wait for each other.
+ *       Pool-wide lock guards only the list of channels ready for processing.
+ */
+class DecoderPool {
+public:
+  /// @brief Channel identifier
+  using ChannelId = size_t;
+
+  /// @brief Amount of samples carried by a single channel queue item
+  static constexpr size_t SAMPLES_BLOCK_SIZE{4096U};
+
+  /// @brief Capacity of the channel's samples queue (in blocks, power of 2)
+  static constexpr size_t CHANNEL_QUEUE_SIZE{16U};
+
+  /// @brief Behaviour of pushing samples to the channel which queue is full
+  enum class OverflowPolicy {
+    Wait,  ///< Wait for the channel's decoder to make room (back-pressure)
+    Drop   ///< Drop the samples (they get counted)
+  };
+
+  /**
+   * @brief Constructor
+   *
+   * @param threadsNo Amount of worker threads (at least one is created)
+   * @param overflowPolicy Behaviour of pushing samples to the channel which queue is full
+   */
+  explicit DecoderPool(size_t threadsNo, OverflowPolicy overflowPolicy = OverflowPolicy::Wait);
+
+  /// @brief Destructor (waits for all queued samples to be processed)
+  ~DecoderPool();
+
+  DecoderPool(const DecoderPool&) = delete;
+  DecoderPool& operator=(const DecoderPool&) = delete;
+
+  /**
+   * @brief Add new channel with its own data decoder and input queue
+   *
+   * @param streamSamplesPerBit Amount of samples per signal bit in the channel
+   * @return ChannelId Identifier of the new channel
+   */
+  ChannelId addChannel(uint8_t streamSamplesPerBit);
+
+  /**
+   * @brief Get channel's data decoder
+   * @note Use it to register callbacks before pushing any samples to the channel.
+   *       Callbacks are called from worker threads but never concurrently for the same channel.
+   *
+   * @param channelId Channel identifier
+   * @return DataDecoder& The decoder
+   */
+  DataDecoder& getDecoder(ChannelId channelId);
+
+  /**
+   * @brief Queue block of samples for processing by the channel's decoder
+   * @note Samples are copied into the channel's queue (its blocks are reused) so the block may be reused as soon as the call returns.
+   *       Samples are processed in the order they were pushed. When the queue is full the call waits or drops the samples
+   *       which don't fit (see OverflowPolicy). Samples of different channels may be pushed concurrently but samples of the same
+   *       channel must be pushed by a single thread at a time.
+   *
+   * @param channelId Channel identifier
+   * @param samples Pointer to the first sample in the block
+   * @param samplesNo Amount of samples in the block
+   * @return true Samples were dropped (channel's queue was full)
+   * @return false All the samples were queued
+   */
+  bool pushSamples(ChannelId channelId, const int16_t* samples, size_t samplesNo);
+
+  /// @brief Wait until all queued samples of all channels are processed
+  void waitIdle();
+
+  /**
+   * @brief Get summary of all the samples processed by the channel so far
+   *
+   * @param channelId Channel identifier
+   * @return DataDecoder::ProcessingResult Processing summary
+   */
+  DataDecoder::ProcessingResult getProcessingResult(ChannelId channelId);
+
+  /**
+   * @brief Get amount of samples dropped by the channel so far (see OverflowPolicy::Drop)
+   *
+   * @param channelId Channel identifier
+   * @return size_t Amount of samples
+   */
+  size_t getDroppedSamplesNo(ChannelId channelId);
+
+private:
+  /// Channel's queue item
+  struct SamplesBlock {
+    std::array<int16_t, SAMPLES_BLOCK_SIZE> samples;
+    size_t samplesNo;
+  };
+
+  struct Channel {
+    explicit Channel(uint8_t streamSamplesPerBit) : decoder(streamSamplesPerBit) {}
+
+    DataDecoder decoder;
+    tools::SpscQueue<SamplesBlock, CHANNEL_QUEUE_SIZE> blocks{};  // blocks allocated once - filled by the producer and processed by a worker without any lock
+    std::mutex mutex{};                                          // guards the channel's fields below
+    std::condition_variable roomAvailable{};
+    size_t droppedSamplesNo{0U};
+    DataDecoder::ProcessingResult processingResult{};
+    bool scheduled{false};  // channel is either waiting in ready queue or being processed by a worker
+  };
+
+  const OverflowPolicy _overflowPolicy;
+
+  std::mutex _mutex{};  // guards the channels list, ready channels and workers state
+
+  std::condition_variable _workAvailable{};
+
+  std::condition_variable _idle{};
+
+  std::vector<std::unique_ptr<Channel>> _channels{};
+
+  std::deque<ChannelId> _readyChannels{};
+
+  std::vector<std::thread> _workers{};
+
+  size_t _busyWorkersNo{0U};
+
+  bool _stopping{false};
+
+  Channel& getChannel(ChannelId channelId);
+
+  void scheduleChannel(ChannelId channelId);
+
+  void workerLoop();
+};
+
+}  // namespace eczas
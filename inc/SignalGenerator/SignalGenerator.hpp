@@ -0,0 +1,137 @@
+/**
+ * @file SignalGenerator.hpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <DataDecoder/DataDecoder.hpp>
+
+#include <stdint.h>
+#include <array>
+#include <cstddef>
+
+namespace eczas {
+
+/// @brief Synthetic eCzasPL signal generator (encoder being the inverse of DataDecoder)
+class SignalGenerator {
+public:
+  /// @brief Seconds between consecutive frames (time message counts 3 second periods)
+  static constexpr uint32_t FRAME_PERIOD_SECONDS{3U};
+
+  /// @brief Seconds between beginning of the year 1970 and 2000
+  static constexpr uint32_t SECONDS_BETWEEN_YEAR_1970_AND_2000{946684800U};
+
+  /// @brief Generated signal parameters
+  struct Config {
+    uint8_t samplesPerBit{10U};                            ///< Amount of samples per signal bit
+    int16_t amplitude{30000};                              ///< Phase change pulse amplitude
+    int16_t noiseAmplitude{0};                             ///< Peak amplitude of the noise added to every sample
+    int32_t clockDriftPpm{0};                              ///< Sampling clock offset to the transmitter's one (positive - more samples per bit)
+    uint32_t utcUnixTimestamp{SECONDS_BETWEEN_YEAR_1970_AND_2000};  ///< UTC time of the 1st frame (rounded down to frame period)
+    uint16_t timeFramesPeriod{20U};                        ///< Every n-th frame is a time frame (other ones carry random data)
+    DataDecoder::TimeZoneOffset offset{DataDecoder::TimeZoneOffset::OffsetPlus0h};  ///< Time zone offset to UTC
+    bool timeZoneChangeAnnouncement{false};                ///< Time zone change announcement flag
+    bool leapSecondAnnounced{false};                       ///< Leap second announcement flag
+    bool leapSecondPositive{false};                        ///< Leap second sign flag
+    DataDecoder::TransmitterState transmitterState{DataDecoder::TransmitterState::NormalOperation};  ///< Transmitter state
+    uint32_t seed{1U};                                     ///< Noise and random frames data seed
+  };
+
+  /**
+   * @brief Constructor
+   *
+   * @param config Generated signal parameters
+   */
+  explicit SignalGenerator(const Config& config);
+
+  /// @brief Default destructor
+  ~SignalGenerator() = default;
+
+  /**
+   * @brief Generate next samples of the signal
+   *
+   * @param samples Pointer to the first sample to be generated
+   * @param samplesNo Amount of samples to be generated
+   */
+  void generate(int16_t* samples, size_t samplesNo);
+
+  /**
+   * @brief Get amount of already generated samples
+   *
+   * @return uint64_t Amount of samples
+   */
+  uint64_t getGeneratedSamplesNo() const;
+
+  /**
+   * @brief Check if frame is a time frame
+   *
+   * @param frameNo Frame number (counted from the signal start)
+   * @return true Frame is a time frame
+   * @return false Frame carries random data
+   */
+  bool isTimeFrame(uint64_t frameNo) const;
+
+  /**
+   * @brief Get number of the sample at which the frame starts (sync word's MSb phase change)
+   *
+   * @param frameNo Frame number (counted from the signal start)
+   * @return uint64_t Sample number
+   */
+  uint64_t getFrameStartSampleNo(uint64_t frameNo) const;
+
+  /**
+   * @brief Get time data carried by the time frame
+   *
+   * @param frameNo Frame number (counted from the signal start)
+   * @return DataDecoder::TimeData Time data
+   */
+  DataDecoder::TimeData getTimeData(uint64_t frameNo) const;
+
+  /**
+   * @brief Encode time data into time frame (sync word, start byte, scrambled time message, Reed-Solomon ECC and CRC8)
+   *
+   * @param timeData Time data (timestamp is rounded down to frame period)
+   * @return DataDecoder::TimeFrame Time frame
+   */
+  static DataDecoder::TimeFrame encodeTimeFrame(const DataDecoder::TimeData& timeData);
+
+private:
+  /// Frame pulses are sent for frame bits and an extra bit returning to the idle carrier phase (bit value 1)
+  static constexpr uint8_t FRAME_PULSES_NO{DataDecoder::TIME_FRAME_BITS_NO + 1U};
+
+  /// Fixed point (32.32) position of the sample in transmitter's samples
+  static constexpr uint8_t POSITION_FRACTION_BITS{32U};
+
+  const Config _config;
+
+  const uint64_t _positionStep;  // transmitter's samples per generated sample (fixed point)
+
+  const uint32_t _framePeriodSamplesNo;  // transmitter's samples per frame
+
+  const uint8_t _pulseSamplesNo;  // phase change pulse width (half of the bit)
+
+  uint64_t _position{0U};  // position of the next sample in transmitter's samples (fixed point)
+
+  uint64_t _generatedSamplesNo{0U};
+
+  uint64_t _pulsesFrameNo{UINT64_MAX};  // frame of which pulses are prepared
+
+  std::array<int8_t, FRAME_PULSES_NO> _pulses{};  // phase change pulse sign for every frame bit (0 - no phase change)
+
+  uint32_t _randomState;
+
+  uint32_t getRandom();
+
+  void preparePulses(uint64_t frameNo);
+
+  static void encodeRsParity(DataDecoder::TimeFrame& timeFrame);
+};
+
+}  // namespace eczas
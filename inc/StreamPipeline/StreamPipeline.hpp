@@ -0,0 +1,212 @@
+/**
+ * @file StreamPipeline.hpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <DataDecoder/DataDecoder.hpp>
+#include <Tools/SampleInput.hpp>
+#include <Tools/SpscQueue.hpp>
+
+#include <stdint.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace eczas {
+
+/// @brief Stream decoding split into reader, decoder and output stages (threads) joined with lock-free queues
+class StreamPipeline {
+public:
+  /// @brief Amount of samples carried by a single samples queue item
+  static constexpr size_t SAMPLES_BLOCK_SIZE{4096U};
+
+  /// @brief Capacity of the samples queue (reader -> decoder)
+  static constexpr size_t SAMPLES_QUEUE_SIZE{64U};
+
+  /// @brief Capacity of the events queue (decoder -> output)
+  static constexpr size_t EVENTS_QUEUE_SIZE{256U};
+
+  /// @brief Stage behaviour when the queue it feeds is full
+  enum class OverflowPolicy {
+    Wait,  ///< Wait for the consumer to make room (back-pressure)
+    Drop   ///< Drop the item (it gets counted)
+  };
+
+  /// @brief Type of the decoding event
+  enum class EventType {
+    RawTimeFrame,              ///< Raw time frame extracted from the stream
+    RsProcessedTimeFrame,      ///< Time frame with Reed-Solomon corrected time data
+    CrcProcessedTimeFrame,     ///< Time frame with CRC corrected SK1 bit
+    TimeData,                  ///< Time data decoded
+    TimeFrameProcessingError,  ///< Time frame processing failed
+    StreamBufferFull,          ///< Decoder's internal buffer got full
+    OutputIdle                 ///< All the events were handled (i.e. buffered output may be flushed)
+  };
+
+  /// @brief Decoding event passed from the decoder to the output stage
+  struct Event {
+    EventType type;                                   ///< Event type
+    uint64_t sampleNo;                                ///< Time frame start sample no (time frame and time data events)
+    DataDecoder::TimeFrame timeFrame;                 ///< Time frame (time frame events)
+    DataDecoder::TimeData timeData;                   ///< Time data (time data event)
+    DataDecoder::TimeFrameProcessingError error;      ///< Processing error (time frame processing error event)
+    uint32_t overrunsNo;                              ///< Number of samples after which buffer was full (stream buffer full event)
+  };
+
+  /// @brief Output stage's handler of decoding events
+  using EventHandler = std::function<void(const Event&)>;
+
+  /// @brief Pipeline parameters
+  struct Config {
+    uint8_t streamSamplesPerBit{10U};                       ///< Amount of samples per signal bit
+    OverflowPolicy samplesOverflowPolicy{OverflowPolicy::Wait};  ///< Reader's policy (waiting holds reading the input)
+    OverflowPolicy eventsOverflowPolicy{OverflowPolicy::Drop};   ///< Decoder's policy (dropping keeps decoding independent of the output)
+    bool timeFramesReported{false};                         ///< Report time frame events (otherwise time data and errors only)
+    DataDecoder::PhaseDiversity phaseDiversity{DataDecoder::PhaseDiversity::Off};  ///< Time frame extraction across sampling phases
+  };
+
+  /// @brief Summary of the stream decoding
+  struct Result {
+    size_t samplesNo;         ///< Number of samples decoded
+    size_t droppedSamplesNo;  ///< Number of samples dropped by the reader (samples queue full)
+    size_t droppedEventsNo;   ///< Number of events dropped by the decoder (events queue full)
+    uint32_t overrunsNo;      ///< Number of samples after which decoder's internal buffer was full
+    uint32_t timeFramesNo;    ///< Number of time frames found
+  };
+
+  /**
+   * @brief Constructor
+   *
+   * @param config Pipeline parameters
+   */
+  explicit StreamPipeline(const Config& config);
+
+  /// @brief Default destructor
+  ~StreamPipeline() = default;
+
+  StreamPipeline(const StreamPipeline&) = delete;
+  StreamPipeline& operator=(const StreamPipeline&) = delete;
+
+  /**
+   * @brief Decode the whole input
+   * @note Input is read by the calling thread while decoding and event handling run on their own threads.
+   *       Returns when all the samples are decoded and all the events are handled.
+   *
+   * @param input Opened samples input
+   * @param eventHandler Handler of decoding events (called from the output thread)
+   * @return Result Decoding summary
+   */
+  Result run(tools::SampleInput& input, const EventHandler& eventHandler);
+
+  /**
+   * @brief Get snapshot of decoder statistics
+   * @note May be called from any thread while the pipeline runs.
+   *
+   * @return DataDecoder::Statistics Statistics snapshot
+   */
+  DataDecoder::Statistics getDecoderStatistics() const;
+
+private:
+  /// Samples queue item
+  struct SamplesBlock {
+    std::array<int16_t, SAMPLES_BLOCK_SIZE> samples;
+    size_t samplesNo;
+  };
+
+  using SamplesQueue = tools::SpscQueue<SamplesBlock, SAMPLES_QUEUE_SIZE>;
+
+  using EventsQueue = tools::SpscQueue<Event, EVENTS_QUEUE_SIZE>;
+
+  /// Decoder stage's sink passing decoder's events to the events queue
+  class DecoderSink : public DataDecoder::NullSink {
+  public:
+    explicit DecoderSink(StreamPipeline& pipeline) : _pipeline(pipeline) {}
+
+    void onRawTimeFrame(const DataDecoder::TimeFrame& timeFrame, uint64_t sampleNo) {
+      pushTimeFrameEvent(EventType::RawTimeFrame, timeFrame, sampleNo);
+    }
+
+    void onRsProcessedTimeFrame(const DataDecoder::TimeFrame& timeFrame, uint64_t sampleNo) {
+      pushTimeFrameEvent(EventType::RsProcessedTimeFrame, timeFrame, sampleNo);
+    }
+
+    void onCrcProcessedTimeFrame(const DataDecoder::TimeFrame& timeFrame, uint64_t sampleNo) {
+      pushTimeFrameEvent(EventType::CrcProcessedTimeFrame, timeFrame, sampleNo);
+    }
+
+    void onTimeData(const DataDecoder::TimeData& timeData, uint64_t sampleNo) {
+      auto event{_pipeline.getEventSlot()};
+      if (event) {
+        event->type = EventType::TimeData;
+        event->sampleNo = sampleNo;
+        event->timeData = timeData;
+        _pipeline._eventsQueue->push();
+      }
+    }
+
+    void onTimeFrameProcessingError(DataDecoder::TimeFrameProcessingError error) {
+      auto event{_pipeline.getEventSlot()};
+      if (event) {
+        event->type = EventType::TimeFrameProcessingError;
+        event->error = error;
+        _pipeline._eventsQueue->push();
+      }
+    }
+
+  private:
+    StreamPipeline& _pipeline;
+
+    void pushTimeFrameEvent(EventType type, const DataDecoder::TimeFrame& timeFrame, uint64_t sampleNo) {
+      if (not _pipeline._config.timeFramesReported) {
+        return;
+      }
+
+      auto event{_pipeline.getEventSlot()};
+      if (event) {
+        event->type = type;
+        event->sampleNo = sampleNo;
+        event->timeFrame = timeFrame;
+        _pipeline._eventsQueue->push();
+      }
+    }
+  };
+
+  const Config _config;
+
+  DataDecoder _decoder;
+
+  // queues are large so they are kept on the heap
+  std::unique_ptr<SamplesQueue> _samplesQueue;
+
+  std::unique_ptr<EventsQueue> _eventsQueue;
+
+  std::atomic<bool> _readerDone{false};  // all the samples are in the samples queue
+
+  std::atomic<bool> _decoderDone{false};  // all the events are in the events queue
+
+  size_t _droppedSamplesNo{0U};  // reader's counter
+
+  size_t _droppedEventsNo{0U};  // decoder's counter
+
+  void readerStage(tools::SampleInput& input);
+
+  void decoderStage(Result& result);
+
+  void outputStage(const EventHandler& eventHandler);
+
+  Event* getEventSlot();
+
+  static void waitForQueue(uint32_t& idleRoundsNo);
+};
+
+}  // namespace eczas
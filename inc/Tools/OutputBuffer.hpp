@@ -0,0 +1,105 @@
+/**
+ * @file OutputBuffer.hpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <array>
+#include <cstddef>
+
+namespace tools {
+
+/// @brief Output written to a file descriptor through a large user-space buffer (text formatting doesn't allocate)
+class OutputBuffer {
+public:
+  /// @brief Size of the buffer (data is written out when it gets full or on flush())
+  static constexpr size_t BUFFER_SIZE{64U * 1024U};
+
+  /**
+   * @brief Constructor
+   *
+   * @param fd File descriptor to write to
+   */
+  explicit OutputBuffer(int fd);
+
+  /// @brief Destructor (flushes buffered data)
+  ~OutputBuffer();
+
+  OutputBuffer(const OutputBuffer&) = delete;
+  OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+  /**
+   * @brief Append data
+   *
+   * @param data Pointer to the data
+   * @param size Size of the data
+   */
+  void append(const void* data, size_t size);
+
+  /**
+   * @brief Append null terminated string
+   *
+   * @param text The string
+   */
+  void append(const char* text);
+
+  /**
+   * @brief Append single character
+   *
+   * @param character The character
+   */
+  void append(char character);
+
+  /**
+   * @brief Append unsigned integer as decimal text
+   *
+   * @param value The value
+   * @param minWidth Minimum amount of characters (value is padded with pad characters)
+   * @param pad Pad character
+   */
+  void appendDecimal(uint64_t value, uint8_t minWidth = 0U, char pad = '0');
+
+  /**
+   * @brief Append byte as two hex digits (upper case)
+   *
+   * @param value The byte
+   */
+  void appendHex(uint8_t value);
+
+  /**
+   * @brief Append byte as eight binary digits (MSb first)
+   *
+   * @param value The byte
+   */
+  void appendBinary(uint8_t value);
+
+  /**
+   * @brief Write buffered data out
+   *
+   * @return true Data could not be written
+   * @return false Data was written (or there was nothing to write)
+   */
+  bool flush();
+
+private:
+  /// Longest decimal text of 64 bit value
+  static constexpr uint8_t MAX_DECIMAL_DIGITS_NO{20U};
+
+  const int _fd;
+
+  std::array<char, BUFFER_SIZE> _buffer{};
+
+  size_t _bufferedBytesNo{0U};
+
+  bool _writeError{false};  // once output fails buffered data is dropped
+};
+
+}  // namespace tools
@@ -0,0 +1,142 @@
+/**
+ * @file RecordWriter.hpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <DataDecoder/DataDecoder.hpp>
+#include <Tools/OutputBuffer.hpp>
+
+#include <stdint.h>
+#include <cstddef>
+#include <optional>
+
+namespace tools {
+
+/// @brief Format of the decoding output
+enum class OutputFormat : uint8_t {
+  Text = 0U,  ///< Human readable text
+  JsonLines,  ///< JSON object per line
+  Binary,     ///< Fixed size binary record (see RecordWriter::BINARY_RECORD_SIZE)
+};
+
+/**
+ * @brief Parse output format name
+ *
+ * @param name Format name (text, jsonl or binary)
+ * @return std::optional<OutputFormat> Format or nothing when name is unknown
+ */
+std::optional<OutputFormat> parseOutputFormat(const char* name);
+
+/**
+ * @brief Writer of decoding results in selected format (buffered, formatting doesn't allocate)
+ * @note Binary record layout (little-endian):
+ *       [0] record type, [1] time frame processing error, [2] time zone offset in hours,
+ *       [3] flags (bit 0: time zone change announced, bit 1: leap second announced, bit 2: leap second positive),
+ *       [4] transmitter state, [5..7] reserved, [8..15] time frame start sample no, [16..19] UTC unix timestamp,
+ *       [20..31] time frame (time frame records) or [20..27] counter value (counter records).
+ */
+class RecordWriter {
+public:
+  /// @brief Type of the record (binary record type values are fixed)
+  enum class RecordType : uint8_t {
+    RawTimeFrame = 0U,         ///< Raw time frame extracted from the stream
+    RsProcessedTimeFrame,      ///< Time frame with Reed-Solomon corrected time data
+    CrcProcessedTimeFrame,     ///< Time frame with CRC corrected SK1 bit
+    TimeData,                  ///< Decoded time data
+    TimeFrameProcessingError,  ///< Time frame processing failed
+    StreamBufferFull,          ///< Counter of samples after which decoder's buffer was full
+    SamplesDropped,            ///< Counter of samples dropped before decoding
+    EventsDropped,             ///< Counter of decoding events dropped before output
+    ProcessedSamples,          ///< Counter of processed samples
+  };
+
+  /// @brief Size of the binary record
+  static constexpr size_t BINARY_RECORD_SIZE{32U};
+
+  /**
+   * @brief Constructor
+   *
+   * @param format Output format
+   * @param fd File descriptor records are written to
+   * @param detailed Text time data records include sample no of their time frame
+   */
+  RecordWriter(OutputFormat format, int fd, bool detailed);
+
+  /// @brief Default destructor (flushes buffered output)
+  ~RecordWriter() = default;
+
+  /**
+   * @brief Write time frame record
+   *
+   * @param type Time frame record type (RawTimeFrame, RsProcessedTimeFrame or CrcProcessedTimeFrame)
+   * @param timeFrame The time frame
+   * @param sampleNo Time frame start sample no
+   */
+  void writeTimeFrame(RecordType type, const eczas::DataDecoder::TimeFrame& timeFrame, uint64_t sampleNo);
+
+  /**
+   * @brief Write time data record
+   *
+   * @param timeData The time data
+   * @param sampleNo Time frame start sample no
+   */
+  void writeTimeData(const eczas::DataDecoder::TimeData& timeData, uint64_t sampleNo);
+
+  /**
+   * @brief Write time frame processing error record
+   *
+   * @param error The error
+   */
+  void writeTimeFrameProcessingError(eczas::DataDecoder::TimeFrameProcessingError error);
+
+  /**
+   * @brief Write counter record
+   *
+   * @param type Counter record type (StreamBufferFull, SamplesDropped, EventsDropped or ProcessedSamples)
+   * @param value Counter value
+   */
+  void writeCounter(RecordType type, uint64_t value);
+
+  /**
+   * @brief Write human readable message
+   * @note Message is buffered with text records while for other formats it goes directly to stderr (not to mix with records).
+   *
+   * @param text The message
+   */
+  void writeMessage(const char* text);
+
+  /**
+   * @brief Write buffered records out
+   * @note Call it whenever no more records are expected for a while (i.e. live stream block is processed).
+   *
+   * @return true Records could not be written
+   * @return false Records were written
+   */
+  bool flush();
+
+private:
+  const OutputFormat _format;
+
+  const bool _detailed;
+
+  OutputBuffer _output;
+
+  void writeTextTime(uint64_t unixTimestamp);
+
+  void writeIsoTime(uint64_t unixTimestamp);
+
+  void writeJsonRecordStart(RecordType type);
+
+  void writeBinaryRecord(RecordType type, const eczas::DataDecoder::TimeFrame* timeFrame, const eczas::DataDecoder::TimeData* timeData,
+                         uint64_t sampleNo, uint8_t error, uint64_t value);
+};
+
+}  // namespace tools
@@ -0,0 +1,91 @@
+/**
+ * @file SampleFormat.hpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <cstddef>
+#include <optional>
+
+namespace tools {
+
+/// @brief Format of the input samples (little-endian)
+enum class SampleFormat : uint8_t {
+  Int16 = 0U,      ///< Signed 16 bit integer (decoder's internal representation)
+  Int32,           ///< Signed 32 bit integer
+  Float32,         ///< 32 bit float (full scale +/-1.0)
+  ComplexFloat32,  ///< Pair of 32 bit floats (I/Q, full scale +/-1.0) - in-phase component is used
+};
+
+/// @brief Location and format of the samples within WAV (RIFF) file
+struct WavDataInfo {
+  SampleFormat format;  ///< Samples format
+  size_t dataOffset;    ///< Offset of the 1st sample from the file start
+  size_t dataSize;      ///< Size of the samples data in bytes
+};
+
+/// @brief Result of WAV header parsing
+enum class WavHeaderStatus : uint8_t {
+  Ok = 0U,        ///< Header parsed
+  NotWav,         ///< Data doesn't start with RIFF/WAVE header
+  Incomplete,     ///< More data is needed to find samples data
+  NotSupported,   ///< WAV file with samples in not supported format
+};
+
+/**
+ * @brief Get size of the single sample in given format
+ *
+ * @param format Samples format
+ * @return size_t Sample size in bytes
+ */
+constexpr size_t getSampleSize(SampleFormat format) {
+  switch (format) {
+    case SampleFormat::Int32:
+    case SampleFormat::Float32:
+      return 4U;
+    case SampleFormat::ComplexFloat32:
+      return 8U;
+    default:
+      return 2U;
+  }
+}
+
+/**
+ * @brief Parse sample format name
+ *
+ * @param name Format name (int16, int32, float32 or cf32)
+ * @return std::optional<SampleFormat> Format or nothing when name is unknown
+ */
+std::optional<SampleFormat> parseSampleFormat(const char* name);
+
+/**
+ * @brief Parse WAV (RIFF) file header
+ * @note Supported are PCM 16 and 32 bit mono, IEEE float 32 bit mono (Float32) and stereo (ComplexFloat32).
+ *
+ * @param data Data from the file start
+ * @param dataSize Amount of available data
+ * @param info Parsed information (valid when WavHeaderStatus::Ok is returned)
+ * @return WavHeaderStatus Parsing result
+ */
+WavHeaderStatus parseWavHeader(const uint8_t* data, size_t dataSize, WavDataInfo& info);
+
+/**
+ * @brief Convert samples into decoder's internal representation
+ * @note Floating point samples are scaled to 16 bit full scale and saturated (NaN is converted to 0), 32 bit integers keep their 16 MSb.
+ *
+ * @param format Format of the input samples
+ * @param input Input samples data (no alignment is required)
+ * @param samplesNo Amount of samples to convert
+ * @param output Converted samples
+ */
+void convertSamples(SampleFormat format, const uint8_t* input, size_t samplesNo, int16_t* output);
+
+}  // namespace tools
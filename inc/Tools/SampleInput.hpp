@@ -0,0 +1,135 @@
+/**
+ * @file SampleInput.hpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <Tools/SampleFormat.hpp>
+
+#include <stdint.h>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace tools {
+
+/// @brief Source of 16 bit samples (memory mapped file or a stream read in large blocks)
+class SampleInput {
+public:
+  /// @brief View of contiguous samples
+  struct SampleBlock {
+    const int16_t* samples;  ///< Pointer to the first sample
+    size_t samplesNo;        ///< Amount of samples
+  };
+
+  /// @brief Size of the buffer used to read samples from a stream (pipe)
+  static constexpr size_t STREAM_BUFFER_SIZE{64U * 1024U};
+
+  /// @brief Default constructor
+  SampleInput() = default;
+
+  /// @brief Destructor (releases the input)
+  ~SampleInput();
+
+  SampleInput(const SampleInput&) = delete;
+  SampleInput& operator=(const SampleInput&) = delete;
+
+  /**
+   * @brief Open input file
+   * @note Regular files are memory mapped, anything else (i.e. pipe) is read as a stream.
+   *       Samples format is taken from WAV header when input has one.
+   *
+   * @param path Path to the file
+   * @param rawFormat Format of the samples when input has no WAV header
+   * @return true Input can't be opened or its format is not supported
+   * @return false Input is ready
+   */
+  bool openFile(const char* path, SampleFormat rawFormat = SampleFormat::Int16);
+
+  /**
+   * @brief Open standard input
+   * @note Standard input redirected from a regular file is memory mapped as well.
+   *       Samples format is taken from WAV header when input has one.
+   *
+   * @param rawFormat Format of the samples when input has no WAV header
+   * @return true Input can't be opened or its format is not supported
+   * @return false Input is ready
+   */
+  bool openStdin(SampleFormat rawFormat = SampleFormat::Int16);
+
+  /**
+   * @brief Get format of the input samples
+   *
+   * @return SampleFormat Samples format
+   */
+  SampleFormat getSampleFormat() const;
+
+  /**
+   * @brief Check if input is memory mapped
+   *
+   * @return true All the samples are available at once (see getAllSamples())
+   * @return false Samples are to be read block by block
+   */
+  bool isMapped() const;
+
+  /**
+   * @brief Get all the samples of memory mapped input
+   * @note Int16 samples are not copied, samples in other formats are converted once.
+   *
+   * @return std::optional<SampleBlock> All the samples or nothing for not mapped input
+   */
+  std::optional<SampleBlock> getAllSamples();
+
+  /**
+   * @brief Get next block of samples
+   * @note Int16 memory mapped input is returned as a single block. Other blocks are valid until the next call.
+   *
+   * @return std::optional<SampleBlock> Next block of samples or nothing at the end of input
+   */
+  std::optional<SampleBlock> getNextBlock();
+
+private:
+  int _fd{-1};
+
+  bool _ownFd{false};
+
+  SampleFormat _format{SampleFormat::Int16};
+
+  void* _mapping{nullptr};
+
+  size_t _mappingSize{0U};
+
+  const uint8_t* _mappedData{nullptr};  // samples data within the mapping (past the WAV header)
+
+  size_t _mappedDataSize{0U};
+
+  size_t _mappedDataConsumedSize{0U};
+
+  std::vector<int16_t> _convertedSamples{};
+
+  std::array<uint8_t, STREAM_BUFFER_SIZE> _rawBuffer{};
+
+  size_t _rawBufferedBytesNo{0U};  // data read from the stream but not converted yet (incomplete sample or data following WAV header)
+
+  std::array<int16_t, STREAM_BUFFER_SIZE / sizeof(int16_t)> _buffer{};
+
+  bool open(int fd, bool ownFd, SampleFormat rawFormat);
+
+  bool openMapped(SampleFormat rawFormat);
+
+  bool openStream(SampleFormat rawFormat);
+
+  bool readStream();
+
+  void close();
+};
+
+}  // namespace tools
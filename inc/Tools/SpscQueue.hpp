@@ -0,0 +1,136 @@
+/**
+ * @file SpscQueue.hpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace tools {
+
+/**
+ * @brief Bounded lock-free queue of a single producer and a single consumer thread
+ * @note Items are written and read in place (getFreeSlot()/push(), getFront()/pop()) so even large ones are never copied
+ *       nor allocated. Producer's and consumer's indexes are kept in separate cache lines.
+ *
+ * @tparam T Item type
+ * @tparam Capacity Maximum amount of queued items (power of 2)
+ */
+template <typename T, size_t Capacity>
+class SpscQueue {
+  static_assert((Capacity != 0U) and ((Capacity & (Capacity - 1U)) == 0U), "Queue capacity must be a power of 2");
+
+public:
+  /// @brief Default constructor
+  SpscQueue() = default;
+
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+
+  /**
+   * @brief Get slot for the next item (producer only)
+   * @note Slot content is left from the item previously stored in it.
+   *
+   * @return T* The slot or nullptr when the queue is full
+   */
+  T* getFreeSlot() {
+    const auto tail{_tail.load(std::memory_order_relaxed)};
+
+    // consumer's index is re-read only when the cached one says queue is full
+    if ((tail - _cachedHead) == Capacity) {
+      _cachedHead = _head.load(std::memory_order_acquire);
+      if ((tail - _cachedHead) == Capacity) {
+        return nullptr;
+      }
+    }
+
+    return &_items[tail & INDEX_MASK];
+  }
+
+  /// @brief Make item written to the slot from getFreeSlot() available to the consumer (producer only)
+  void push() {
+    _tail.store(_tail.load(std::memory_order_relaxed) + 1U, std::memory_order_release);
+  }
+
+  /**
+   * @brief Copy the item into the queue (producer only)
+   *
+   * @param item The item
+   * @return true Queue is full (item is not queued)
+   * @return false Item is queued
+   */
+  bool push(const T& item) {
+    static constexpr bool NO_ERROR{false};
+    static constexpr bool AN_ERROR{true};
+
+    auto slot{getFreeSlot()};
+    if (slot == nullptr) {
+      return AN_ERROR;
+    }
+
+    *slot = item;
+    push();
+
+    return NO_ERROR;
+  }
+
+  /**
+   * @brief Get the oldest item (consumer only)
+   *
+   * @return T* The item or nullptr when the queue is empty
+   */
+  T* getFront() {
+    const auto head{_head.load(std::memory_order_relaxed)};
+
+    // producer's index is re-read only when the cached one says queue is empty
+    if (head == _cachedTail) {
+      _cachedTail = _tail.load(std::memory_order_acquire);
+      if (head == _cachedTail) {
+        return nullptr;
+      }
+    }
+
+    return &_items[head & INDEX_MASK];
+  }
+
+  /// @brief Release the slot of the item from getFront() back to the producer (consumer only)
+  void pop() {
+    _head.store(_head.load(std::memory_order_relaxed) + 1U, std::memory_order_release);
+  }
+
+  /**
+   * @brief Check if queue is empty
+   * @note Result is exact for the consumer only (producer may be pushing at the same time).
+   *
+   * @return true No items are queued
+   * @return false There are items queued
+   */
+  bool isEmpty() const {
+    return (_head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire));
+  }
+
+private:
+  static constexpr size_t INDEX_MASK{Capacity - 1U};
+
+  static constexpr size_t CACHE_LINE_SIZE{64U};
+
+  // indexes grow freely (wrapping around is harmless as capacity is a power of 2)
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> _head{0U};  // next item to be read (written by the consumer)
+  size_t _cachedTail{0U};                                  // consumer's copy of _tail
+
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> _tail{0U};  // next slot to be written (written by the producer)
+  size_t _cachedHead{0U};                                  // producer's copy of _head
+
+  alignas(CACHE_LINE_SIZE) std::array<T, Capacity> _items{};
+};
+
+}  // namespace tools
@@ -0,0 +1,117 @@
+/**
+ * @file ChunkedDecoder.cpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <ChunkedDecoder/ChunkedDecoder.hpp>
+
+#include <atomic>
+#include <thread>
+#include <utility>
+
+namespace eczas {
+
+namespace {
+
+/// @brief Outcome of a single chunk decoding
+struct ChunkResult {
+  std::vector<ChunkedDecoder::TimeDataRecord> timeData{};
+  uint32_t overrunsNo{0U};
+};
+
+/// @brief Chunk decoder's sink collecting time data of frames starting within the chunk
+class ChunkSink : public DataDecoder::NullSink {
+public:
+  ChunkSink(ChunkResult& chunkResult, size_t decodingStart, size_t chunkStart, size_t chunkEnd)
+    : _chunkResult(chunkResult),
+      _decodingStart(decodingStart),
+      _chunkStart(chunkStart),
+      _chunkEnd(chunkEnd) {
+  }
+
+  void onTimeData(const DataDecoder::TimeData& timeData, uint64_t decodedSampleNo) {
+    const auto sampleNo{_decodingStart + decodedSampleNo};
+
+    // frames starting in the lead-in region belong to the previous chunk and the ones in the overlap region to the next chunk
+    if ((sampleNo >= _chunkStart) and (sampleNo < _chunkEnd)) {
+      _chunkResult.timeData.push_back({timeData, sampleNo});
+    }
+  }
+
+private:
+  ChunkResult& _chunkResult;
+
+  const size_t _decodingStart;
+
+  const size_t _chunkStart;
+
+  const size_t _chunkEnd;
+};
+
+}  // namespace
+
+ChunkedDecoder::ChunkedDecoder(uint8_t streamSamplesPerBit, size_t threadsNo, size_t chunkSamplesNo, DataDecoder::PhaseDiversity phaseDiversity)
+  : _streamSamplesPerBit(streamSamplesPerBit),
+    _threadsNo((threadsNo == 0U) ? 1U : threadsNo),
+    _chunkSamplesNo((chunkSamplesNo == 0U) ? 1U : chunkSamplesNo),
+    _phaseDiversity(phaseDiversity) {
+}
+
+ChunkedDecoder::Result ChunkedDecoder::decode(const int16_t* samples, size_t samplesNo) const {
+  const auto chunksNo{(samplesNo + _chunkSamplesNo - 1U) / _chunkSamplesNo};
+  const auto overlapSamplesNo{getOverlapSamplesNo(_streamSamplesPerBit)};
+  const auto leadInSamplesNo{getLeadInSamplesNo(_streamSamplesPerBit)};
+
+  std::vector<ChunkResult> chunkResults(chunksNo);
+  std::atomic<size_t> nextChunkNo{0U};
+
+  // workers take chunks one by one until all are decoded
+  auto worker{[&]() {
+    for (auto chunkNo{nextChunkNo.fetch_add(1U)}; chunkNo < chunksNo; chunkNo = nextChunkNo.fetch_add(1U)) {
+      const auto chunkStart{chunkNo * _chunkSamplesNo};
+      const auto chunkEnd{((samplesNo - chunkStart) < _chunkSamplesNo) ? samplesNo : (chunkStart + _chunkSamplesNo)};
+      const auto chunkWithOverlapEnd{((samplesNo - chunkEnd) < overlapSamplesNo) ? samplesNo : (chunkEnd + overlapSamplesNo)};
+      const auto decodingStart{(chunkStart < leadInSamplesNo) ? 0U : (chunkStart - leadInSamplesNo)};
+      auto& chunkResult{chunkResults[chunkNo]};
+
+      DataDecoder decoder{_streamSamplesPerBit};
+      decoder.setPhaseDiversity(_phaseDiversity);
+      ChunkSink sink{chunkResult, decodingStart, chunkStart, chunkEnd};
+
+      // overruns are counted for the chunk's own samples only (lead-in and overlap ones are counted by the neighbouring chunks)
+      decoder.processSamples(samples + decodingStart, chunkStart - decodingStart, sink);
+      chunkResult.overrunsNo = decoder.processSamples(samples + chunkStart, chunkEnd - chunkStart, sink).overrunsNo;
+      decoder.processSamples(samples + chunkEnd, chunkWithOverlapEnd - chunkEnd, sink);
+    }
+  }};
+
+  std::vector<std::thread> workers{};
+  const auto workersNo{(chunksNo < _threadsNo) ? chunksNo : _threadsNo};
+  for (size_t workerNo{0U}; workerNo < workersNo; workerNo++) {
+    workers.emplace_back(worker);
+  }
+  for (auto& thread : workers) {
+    thread.join();
+  }
+
+  // chunks are ordered so merging them keeps sample number order (same frame is never reported twice)
+  Result result{};
+  for (auto& chunkResult : chunkResults) {
+    for (auto& record : chunkResult.timeData) {
+      if (result.timeData.empty() or (result.timeData.back().sampleNo < record.sampleNo)) {
+        result.timeData.push_back(record);
+      }
+    }
+    result.overrunsNo += chunkResult.overrunsNo;
+  }
+
+  return result;
+}
+
+}  // namespace eczas
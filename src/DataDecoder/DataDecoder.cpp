@@ -10,426 +10,311 @@
  */
 
 #include <DataDecoder/DataDecoder.hpp>
-#include <CRC8/CRC8.hpp>
+#include <DataDecoder/Crc8.hpp>
+#include <DataDecoder/Gf16.hpp>
 
-#include <cstdlib>
 #include <stdint.h>
+#include <array>
 #include <optional>
-#include <tuple>
 #include <utility>
 
 namespace eczas {
 
-DataDecoder::DataDecoder(uint8_t streamSamplesPerBit) : _streamSamplesPerBit(streamSamplesPerBit) {
-  _stream.fill(0);
-  _correlator.fill(false);
-  _sampleNo.fill(0U);
-}
-
-bool DataDecoder::processNewSample(int16_t sample) {
-  static auto sampleNo{0U};
-  static auto syncWordLookup{true};
-
-  addNewData(sample, sampleNo);
-  calculateSyncWordCorrelation();
-
-  if (syncWordLookup and syncWordDetectedByCorrelation()) {
-    syncWordLookup = false;
-  }
-
-  if (not syncWordLookup) {
-    const auto nextTimeFrameStartIndexGetter{getTimeFrameDataFromStream()};
-
-    if (nextTimeFrameStartIndexGetter.has_value()) {
-      const auto timeFrameProcessingError{processTimeFrameData()};
-
-      if (timeFrameProcessingError) {
-        // currently extracted frame doesn't look like the one we are looking for - increase _meaningfulDataStartIndex by one
-        _meaningfulDataStartIndex++;
-      } else {
-        // move stream meaningful data index beyond already extracted time frame (to prevent repeated detection)
-        _meaningfulDataStartIndex = nextTimeFrameStartIndexGetter.value();
-      }
+namespace {
 
-      syncWordLookup = true;
-    }
-  }
+/// SK1 is the LSb of the last byte covered by CRC8 so its error is recognized by the syndrome (CRC is linear)
+constexpr std::array<uint8_t, DataDecoderBase::CRC8_DATA_BYTES_NO> SK1_ERROR_PATTERN{0x00, 0x00, 0x00, 0x00, 0x01};
 
-  // update sample no for next iteration
-  sampleNo++;
+constexpr uint8_t SK1_ERROR_SIGNATURE{crc8::calculateErrorSignature<DataDecoderBase::CRC8_POLYNOMIAL>(SK1_ERROR_PATTERN)};
 
-  // return if buffer is full
-  return (_meaningfulDataStartIndex == 0U);
-}
+}  // namespace
 
-void DataDecoder::registerTimeDataCallback(TimeDataCallback callback) {
+void DataDecoderBase::registerTimeDataCallback(TimeDataCallback callback) {
   _timeDataCallback = std::move(callback);
 }
 
-void DataDecoder::registerRawTimeFrameCallback(TimeFrameCallback callback) {
+void DataDecoderBase::registerRawTimeFrameCallback(TimeFrameCallback callback) {
   _rawTimeFrameCallback = std::move(callback);
 }
 
-void DataDecoder::registerRsProcessedTimeFrameCallback(TimeFrameCallback callback) {
+void DataDecoderBase::registerRsProcessedTimeFrameCallback(TimeFrameCallback callback) {
   _rsProcessedTimeFrameCallback = std::move(callback);
 }
 
-void DataDecoder::registerCrcProcessedTimeFrameCallback(TimeFrameCallback callback) {
+void DataDecoderBase::registerCrcProcessedTimeFrameCallback(TimeFrameCallback callback) {
   _crcProcessedTimeFrameCallback = std::move(callback);
 }
 
-void DataDecoder::registerTimeFrameProcessingErrorCallback(TimeFrameProcessingErrorCallback callback) {
+void DataDecoderBase::registerTimeFrameProcessingErrorCallback(TimeFrameProcessingErrorCallback callback) {
   _timeFrameProcessingErrorCallback = std::move(callback);
 }
 
-void DataDecoder::addNewData(int16_t sample, uint32_t sampleNo) {
-  // TODO: redo using circular buffer
-
-  // move meaningful data left
-  if (_meaningfulDataStartIndex < STREAM_SIZE) {
-    if (_meaningfulDataStartIndex == LAST_STREAM_INDEX) {
-      _stream[LAST_STREAM_INDEX - 1U] = _stream[LAST_STREAM_INDEX];
-      _correlator[LAST_STREAM_INDEX - 1U] = _correlator[LAST_STREAM_INDEX];
-      _sampleNo[LAST_STREAM_INDEX - 1U] = _sampleNo[LAST_STREAM_INDEX];
-    } else {
-      if (_meaningfulDataStartIndex != 0U) {
-        _stream[_meaningfulDataStartIndex - 1U] = _stream[_meaningfulDataStartIndex];
-        _correlator[_meaningfulDataStartIndex - 1U] = _correlator[_meaningfulDataStartIndex];
-        _sampleNo[_meaningfulDataStartIndex - 1U] = _sampleNo[_meaningfulDataStartIndex];
-      }
+DataDecoderBase::Statistics DataDecoderBase::getStatistics() const {
+  Statistics statistics{};
 
-      for (uint16_t streamIndex{_meaningfulDataStartIndex}; streamIndex < LAST_STREAM_INDEX; streamIndex++) {
-        _stream[streamIndex] = _stream[streamIndex + 1U];
-        _correlator[streamIndex] = _correlator[streamIndex + 1U];
-        _sampleNo[streamIndex] = _sampleNo[streamIndex + 1U];
-      }
-    }
+  statistics.samplesNo = _statistics.samplesNo.load(std::memory_order_relaxed);
+  statistics.overrunsNo = _statistics.overrunsNo.load(std::memory_order_relaxed);
+  statistics.syncWordDetectionsNo = _statistics.syncWordDetectionsNo.load(std::memory_order_relaxed);
+  statistics.staticFieldsRejectionsNo = _statistics.staticFieldsRejectionsNo.load(std::memory_order_relaxed);
+  for (size_t fixedSymbolsNo{0U}; fixedSymbolsNo < statistics.rsCorrectionsNo.size(); fixedSymbolsNo++) {
+    statistics.rsCorrectionsNo[fixedSymbolsNo] = _statistics.rsCorrectionsNo[fixedSymbolsNo].load(std::memory_order_relaxed);
   }
+  statistics.softDecisionRecoveriesNo = _statistics.softDecisionRecoveriesNo.load(std::memory_order_relaxed);
+  statistics.rsFailuresNo = _statistics.rsFailuresNo.load(std::memory_order_relaxed);
+  statistics.sk1RepairsNo = _statistics.sk1RepairsNo.load(std::memory_order_relaxed);
+  statistics.crcFailuresNo = _statistics.crcFailuresNo.load(std::memory_order_relaxed);
+  statistics.timeFramesNo = _statistics.timeFramesNo.load(std::memory_order_relaxed);
+  statistics.backlogSamplesNo = _statistics.backlogSamplesNo.load(std::memory_order_relaxed);
 
-  // add new data
-  _stream[LAST_STREAM_INDEX] = sample;
-  _correlator[LAST_STREAM_INDEX] = false;
-  _sampleNo[LAST_STREAM_INDEX] = sampleNo;
+  return statistics;
+}
 
-  // update fresh data index
-  if (_meaningfulDataStartIndex) {
-    _meaningfulDataStartIndex--;
-  }
+void DataDecoderBase::incrementCounter(std::atomic<uint64_t>& counter) {
+  // counters have a single writer so no atomic read-modify-write (locked instruction) is needed
+  counter.store(counter.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
 }
 
-void DataDecoder::calculateSyncWordCorrelation() {
-  /* Calculate correlation against 16 bit sync word 0x5555 (alternating bit values)
-     - LSb of the sync word is the last sample in the stream buffer and should be 1,
-     - sync word bit samples used in calculation are spaced in buffer with _streamSamplesPerBit,
-     - MSb of the sync word is located (15 * _streamSamplesPerBit) bits back with respect to LSb sample,
-     - correlation is placed at sync word's MSb index to ease further localization of the frame start,
-     - carrier phase changes are expected to be cyclic (no value stalling causing stream sample value to be around 0),
-     - stream samples representing sync word bits are expected to have significant values,
-
-     Data frames are separated with some fill-up time so they can start at full second.
-     Before beginning of the sync word stream values are around value 0 (no carrier phase change).
-     Drop in stream's sample value below 0 (and lower hysteresis region) is an indication of the start of bit value 0 transmission.
-     Jump in stream's sample value above 0 (and higher hysteresis region) is an indication of the start of bit value 1 transmission.
-     Each time frame starts with an indication of the bit value 0 being transmitted.
-     In order to detect where sync word 0x5555 lay in the stream a correlation estimate is calculated on each new signal sample recption. */
-
-  bool correlationDetected{true};
-  auto streamIndexToSyncWordBit{LAST_STREAM_INDEX};
-
-  if (_stream[streamIndexToSyncWordBit] > 0) {  // validate potential value of the sync word's LSb
-    for (uint8_t syncWordBitNo{0U}; syncWordBitNo < SYNC_WORD_BITS_NO; syncWordBitNo++) {
-      if (not isSampleValueOutOfNoiseRegion(streamIndexToSyncWordBit)) {
-        correlationDetected = false;
-        break;
-      }
-      streamIndexToSyncWordBit -= _streamSamplesPerBit;
-    }
-  } else {
-    // stream sample for sync word LSb wasn't indicating it may be 1
-    correlationDetected = false;
-  }
+uint8_t DataDecoderBase::getSampleConfidence(int16_t sample) {
+  // the further sample value is from the noise hysteresis the more confident significance decision is (no matter which one)
+  const auto magnitude{(sample < 0) ? -static_cast<int32_t>(sample) : static_cast<int32_t>(sample)};
+  const auto distance{(magnitude > STREAM_NOISE_HYSTERESIS) ? (magnitude - STREAM_NOISE_HYSTERESIS) : (STREAM_NOISE_HYSTERESIS - magnitude)};
+  const auto confidence{distance >> SAMPLE_CONFIDENCE_SHIFT};
 
-  // store correlation result into the buffer at sync word's start index
-  const auto syncWordStartIndex{static_cast<uint16_t>(LAST_STREAM_INDEX - static_cast<uint16_t>(static_cast<uint16_t>(SYNC_WORD_BITS_NO - 1U) * _streamSamplesPerBit))};
-  _correlator[syncWordStartIndex] = correlationDetected;
+  return static_cast<uint8_t>((confidence > UINT8_MAX) ? UINT8_MAX : confidence);
 }
 
-bool DataDecoder::isSampleValueOutOfNoiseRegion(uint16_t index) {
-  if (index >= STREAM_SIZE) {
-    // Sample index is out of range
-    return false;
+bool DataDecoderBase::validateTimeFrameStaticFields() {
+  static constexpr bool NO_ERROR{false};
+  static constexpr bool AN_ERROR{true};
+
+  ECZAS_TRACE_SCOPE(ValidateTimeFrameStaticFields);
+
+  // validate synchronization word
+  const auto frameSyncWordOk{_timeFrame.get(PackedTimeFrame::SYNC_WORD) == SYNC_WORD};
+  if (not frameSyncWordOk) {
+    return AN_ERROR;
   }
 
-  const auto sampleValue{_stream[index]};
-  return (abs(sampleValue) > STREAM_NOISE_HYSTERESIS);
+  // validate time frame start byte
+  const auto timeFrameStartByteOk{_timeFrame.get(PackedTimeFrame::START_BYTE) == TIME_FRAME_START_BYTE};
+  if (not timeFrameStartByteOk) {
+    return AN_ERROR;
+  }
+
+  // validate time frame static bits (3 MSb of byte 3 is 0b101)
+  const auto timeFrameStaticBitsOk{_timeFrame.get(PackedTimeFrame::TIME_MESSAGE_PREFIX) == TIME_MESSAGE_PREFIX};
+  if (not timeFrameStaticBitsOk) {
+    return AN_ERROR;
+  }
+
+  return NO_ERROR;
 }
 
-bool DataDecoder::syncWordDetectedByCorrelation() {
-  const auto samplesNoForSyncWord{static_cast<uint16_t>(static_cast<uint16_t>(static_cast<uint16_t>(SYNC_WORD_BITS_NO - 1U) * _streamSamplesPerBit) + 1U)};
-  const auto samplesNoWithoutCorrelationData{static_cast<uint16_t>(samplesNoForSyncWord - 1U)};  // correlation is calculated for sync word length backwards from newly added sample so for any newly added sample respective correlation is saved 15 bits (spaced every _streamSamplesPerBit) earlier at MSb index
-  const auto startIndexOfNotCalculatedCorrelatorData{static_cast<uint16_t>(STREAM_SIZE - samplesNoWithoutCorrelationData)};
+std::optional<uint8_t> DataDecoderBase::correctTimeFrameErrorsWithRsFec() {
+  ECZAS_TRACE_SCOPE(CorrectTimeFrameErrorsWithRsFec);
 
-  // validate if it is worth doing any data analysis
-  if (_meaningfulDataStartIndex >= startIndexOfNotCalculatedCorrelatorData) {
-    return false;
-  }
+  // lookup and correct time message (S0-SK0) errors using Reed-Solomon FEC data (ECC0-ECC2)
 
-  auto syncWordDetected{false};
-  auto syncWordStartIndex{0U};
+  // 1. Get codeword from the time frame
+  auto codeword{getRsCodewordFromTimeFrame()};
 
-  // using correlation array find index of the 1st detected sync word presence
-  for (auto correlatorIndex{_meaningfulDataStartIndex}; correlatorIndex < startIndexOfNotCalculatedCorrelatorData; correlatorIndex++) {
-    if (_correlator[correlatorIndex]) {
-      syncWordDetected = true;
-      syncWordStartIndex = correlatorIndex;
-      break;
-    }
+  // 2. Valid codeword (the most common case) needs no correction so the time frame is left as is
+  const auto syndromes{calculateRsSyndromes(codeword)};
+  if (not rsSyndromesIndicateErrors(syndromes)) {
+    return 0U;
   }
 
-  // if sync word is not detected invalidate all acquired data (where correlation was estimated)
-  if (not syncWordDetected) {
-    _meaningfulDataStartIndex = startIndexOfNotCalculatedCorrelatorData;
-    return false;
+  // 3. Recover possibly faulty codeword (single symbol error directly from syndromes, multiple ones using full RS decoder)
+  uint8_t fixedSymbolsNo{1U};
+  if (correctSingleRsSymbolError(codeword, syndromes)) {
+    const auto receivedCodeword{codeword};
+    const auto recoveryError{_rs.recoverCodeword(codeword)};
+    if (recoveryError) {
+      return {};
+    }
+    fixedSymbolsNo = countRsSymbolDifferences(receivedCodeword, codeword);
   }
 
-  // 1st correlation index was found - all the data before syncWordStartIndex is not usable
-  _meaningfulDataStartIndex = syncWordStartIndex;
+  // 4. Update the time frame with corrected data
+  updateTimeFrameWithRsCodeword(codeword);
 
-  return true;
+  return fixedSymbolsNo;
 }
 
-std::optional<std::tuple<uint8_t, uint16_t, bool>> DataDecoder::getByteFromStream(uint16_t startIndex, bool initialBitValueIsOne) {
-  // MSb is at startIndex, rest is spaced with _streamSamplesPerBit
-  const auto lastIndexOfByteData{static_cast<uint16_t>(startIndex + (static_cast<uint16_t>(_streamSamplesPerBit) * 7U))};
+DataDecoderBase::RS::Codeword DataDecoderBase::getRsCodewordFromTimeFrame() const {
+  // data symbols S0-SK0 are not aligned to time frame bytes so symbols are taken as packed time frame fields
+  RS::Codeword codeword{};
+
+  for (uint8_t symbolIndex{0U}; symbolIndex < RS_CODEWORD_SYMBOLS_NO; symbolIndex++) {
+    codeword[symbolIndex] = _timeFrame.getRsSymbol(symbolIndex);
+  }
+
+  return codeword;
+}
 
-  // validate if byte data fit into the buffer
-  if (lastIndexOfByteData > LAST_STREAM_INDEX) {
-    return {};
+void DataDecoderBase::updateTimeFrameWithRsCodeword(const RS::Codeword& codeword) {
+  // time message static prefix and SK1 are not covered by the codeword so they are left untouched
+  for (uint8_t symbolIndex{0U}; symbolIndex < RS_CODEWORD_SYMBOLS_NO; symbolIndex++) {
+    _timeFrame.setRsSymbol(symbolIndex, codeword[symbolIndex]);
   }
+}
 
-  uint16_t bitIndex{startIndex};
-  bool bitValueIsOne{initialBitValueIsOne};
+DataDecoderBase::RsSyndromes DataDecoderBase::calculateRsSyndromes(const RS::Codeword& codeword) {
+  /* Syndrome S(j) is the codeword polynomial evaluated at x^j (j = 1..6, generator's initial root is x).
+     Codeword symbol at index i is a coefficient of x^((i + RS_FIRST_SYMBOL_POWER) mod 15). */
+  RsSyndromes syndromes{};
 
-  // get data from stream (MSb to LSb)
-  uint8_t byteFromStream{0U};
-  for (auto bitNo{0U}; bitNo < 8U; bitNo++) {
-    // on 1st pass it doesn't harm the value as it is initialized to 0
-    byteFromStream <<= 1U;
+  for (uint8_t syndromeNo{0U}; syndromeNo < RS_PARITY_SYMBOLS_NO; syndromeNo++) {
+    const auto root{gf16::pow(syndromeNo + 1U)};
+    uint8_t syndrome{0U};
 
-    // significant sample value mean there was a signal phase change thus bit value has changed
-    if (isSampleValueOutOfNoiseRegion(bitIndex)) {
-      bitValueIsOne = !bitValueIsOne;
+    // Horner's scheme starting with the coefficient of the highest power
+    for (auto power{static_cast<int8_t>(RS_CODEWORD_SYMBOLS_NO - 1U)}; power >= 0; power--) {
+      const auto symbolIndex{static_cast<uint8_t>((power + RS_CODEWORD_SYMBOLS_NO - RS_FIRST_SYMBOL_POWER) % RS_CODEWORD_SYMBOLS_NO)};
+      syndrome = static_cast<uint8_t>(gf16::mul(syndrome, root) ^ codeword[symbolIndex]);
     }
 
-    // retrieve correct bit value
-    byteFromStream |= (bitValueIsOne ? 0x01 : 0x00);
-
-    // go ahead with next bit
-    bitIndex += _streamSamplesPerBit;
+    syndromes[syndromeNo] = syndrome;
   }
 
-  // result include starting conditions for next byte retrieval
-  return std::make_tuple(byteFromStream, bitIndex, bitValueIsOne);
+  return syndromes;
 }
 
-std::optional<uint16_t> DataDecoder::getTimeFrameDataFromStream() {
-  const auto samplesNoForTimeFrame{static_cast<uint16_t>(static_cast<uint16_t>(static_cast<uint16_t>(TIME_FRAME_BYTES_NO) * 8U * _streamSamplesPerBit) - _streamSamplesPerBit)};  // samples are spaced every _streamSamplesPerBit
-
-  // check if it is possible to extract required amount of data
-  if (_meaningfulDataStartIndex > (STREAM_SIZE - samplesNoForTimeFrame)) {
-    return {};
+bool DataDecoderBase::rsSyndromesIndicateErrors(const RsSyndromes& syndromes) {
+  uint8_t syndromesSum{0U};
+  for (const auto syndrome : syndromes) {
+    syndromesSum |= syndrome;
   }
 
-  // retrieve the data
-  uint16_t byteStartIndex{_meaningfulDataStartIndex};
-  bool startingBitValueIsOne{FRAME_DATA_READ_START_PRECONDITION};
-
-  for (auto dataByteNo{0U}; dataByteNo < TIME_FRAME_BYTES_NO; dataByteNo++) {
-    const auto dataByteGetter{getByteFromStream(byteStartIndex, startingBitValueIsOne)};
+  return (syndromesSum != 0U);
+}
 
-    if (not dataByteGetter.has_value()) {
-      // Can't get byte from the stream
-      return {};
+uint8_t DataDecoderBase::countRsSymbolDifferences(const RS::Codeword& codeword, const RS::Codeword& otherCodeword) {
+  uint8_t differentSymbolsNo{0U};
+  for (uint8_t symbolIndex{0U}; symbolIndex < RS_CODEWORD_SYMBOLS_NO; symbolIndex++) {
+    if (codeword[symbolIndex] != otherCodeword[symbolIndex]) {
+      differentSymbolsNo++;
     }
-
-    const auto [dataByte, nextByteStartIndex, bitValueIsOne] = dataByteGetter.value();
-
-    _timeFrame.at(dataByteNo) = dataByte;
-    byteStartIndex = nextByteStartIndex;
-    startingBitValueIsOne = bitValueIsOne;
   }
 
-  return byteStartIndex;
+  return differentSymbolsNo;
 }
 
-bool DataDecoder::processTimeFrameData() {
+bool DataDecoderBase::correctSingleRsSymbolError(RS::Codeword& codeword, const RsSyndromes& syndromes) {
   static constexpr bool NO_ERROR{false};
   static constexpr bool AN_ERROR{true};
 
-  if (validateTimeFrameStaticFields()) {
+  /* Single error of value E at the power P gives syndromes S(j) = E * X^j where X = x^P.
+     Such syndromes form geometric sequence (S(j+1) = S(j) * X), otherwise there is more than one error. */
+  if (syndromes[0] == 0U) {
     return AN_ERROR;
   }
 
-  // notify raw time frame extracted from the stream
-  if (_rawTimeFrameCallback) {
-    _rawTimeFrameCallback({_timeFrame, _sampleNo[_meaningfulDataStartIndex]});
-  }
-
-  if (correctTimeFrameErrorsWithRsFec()) {
-    if (_timeFrameProcessingErrorCallback) {
-      _timeFrameProcessingErrorCallback(TimeFrameProcessingError::RsCorrectionFailed);
-    }
+  const auto errorLocator{gf16::div(syndromes[1], syndromes[0])};
+  if (errorLocator == 0U) {
     return AN_ERROR;
   }
 
-  // notify time frame with RS corrected time data
-  if (_rsProcessedTimeFrameCallback) {
-    _rsProcessedTimeFrameCallback({_timeFrame, _sampleNo[_meaningfulDataStartIndex]});
-  }
-
-  if (correctSk1ErrorWithCrc()) {
-    // TODO: add option to not throw time frame away if transmitter state is not as important
-    if (_timeFrameProcessingErrorCallback) {
-      _timeFrameProcessingErrorCallback(TimeFrameProcessingError::CrcCorrectionFailed);
+  for (uint8_t syndromeNo{1U}; syndromeNo < (RS_PARITY_SYMBOLS_NO - 1U); syndromeNo++) {
+    if (gf16::mul(syndromes[syndromeNo], errorLocator) != syndromes[syndromeNo + 1U]) {
+      return AN_ERROR;
     }
-    return AN_ERROR;
-  }
-
-  // notify time frame with CRC corrected SK1 bit
-  if (_crcProcessedTimeFrameCallback) {
-    _crcProcessedTimeFrameCallback({_timeFrame, _sampleNo[_meaningfulDataStartIndex]});
   }
 
-  descrambleTimeMessage();
-  extractTimeData();
-
-  // notify time data
-  if (_timeDataCallback) {
-    _timeDataCallback({_timeData, _sampleNo[_meaningfulDataStartIndex]});
-  }
+  const auto errorPower{gf16::LOG[errorLocator]};
+  const auto symbolIndex{static_cast<uint8_t>((errorPower + RS_CODEWORD_SYMBOLS_NO - RS_FIRST_SYMBOL_POWER) % RS_CODEWORD_SYMBOLS_NO)};
+  codeword[symbolIndex] ^= gf16::div(syndromes[0], errorLocator);
 
   return NO_ERROR;
 }
 
-bool DataDecoder::validateTimeFrameStaticFields() {
-  static constexpr bool NO_ERROR{false};
+bool DataDecoderBase::correctRsErasures(RS::Codeword& codeword, const RsSyndromes& syndromes, const RsErasures& erasedSymbolIndexes, uint8_t erasuresNo) {
   static constexpr bool AN_ERROR{true};
 
-  // validate synchronization word
-  const auto frameSyncWordOk{(_timeFrame.at(0) == static_cast<uint8_t>(SYNC_WORD >> 8U)) and (_timeFrame.at(1) == static_cast<uint8_t>(SYNC_WORD & 0x00FF))};
-  if (not frameSyncWordOk) {
+  /* Erasure locator L(y) = (1 + X1*y)...(1 + Xe*y) where Xi = x^Pi for erased symbol being a coefficient of x^Pi.
+     Erasure evaluator O(y) = S(y) * L(y) mod y^e where S(y) = S(1) + S(2)*y + ... + S(6)*y^5.
+     Erased symbol error value is O(1/Xi) / L'(1/Xi) (Forney algorithm).
+     Recovery is valid when syndromes of the corrected codeword are all 0 (uses parity symbols not needed for erasures). */
+  if ((erasuresNo == 0U) or (erasuresNo > RS_MAX_ERASURES_NO)) {
     return AN_ERROR;
   }
 
-  // validate time frame start byte
-  const auto timeFrameStartByteOk{_timeFrame.at(2) == TIME_FRAME_START_BYTE};
-  if (not timeFrameStartByteOk) {
-    return AN_ERROR;
-  }
+  std::array<uint8_t, RS_MAX_ERASURES_NO> erasureLocators{};
+  std::array<uint8_t, RS_MAX_ERASURES_NO + 1U> locator{1U};
 
-  // validate time frame static bits (3 MSb of byte 3 is 0b101)
-  const auto timeFrameStaticBitsOk{(static_cast<uint8_t>(_timeFrame.at(3) >> 5U) == TIME_MESSAGE_PREFIX)};
-  if (not timeFrameStaticBitsOk) {
-    return AN_ERROR;
+  for (uint8_t erasureNo{0U}; erasureNo < erasuresNo; erasureNo++) {
+    erasureLocators[erasureNo] = gf16::pow((erasedSymbolIndexes[erasureNo] + RS_FIRST_SYMBOL_POWER) % RS_CODEWORD_SYMBOLS_NO);
+    for (auto coefficientNo{static_cast<uint8_t>(erasureNo + 1U)}; coefficientNo > 0U; coefficientNo--) {
+      locator[coefficientNo] ^= gf16::mul(locator[coefficientNo - 1U], erasureLocators[erasureNo]);
+    }
   }
 
-  return NO_ERROR;
-}
-
-bool DataDecoder::correctTimeFrameErrorsWithRsFec() {
-  static constexpr bool NO_ERROR{false};
-  static constexpr bool AN_ERROR{true};
+  std::array<uint8_t, RS_MAX_ERASURES_NO> evaluator{};
+  for (uint8_t coefficientNo{0U}; coefficientNo < erasuresNo; coefficientNo++) {
+    for (uint8_t locatorCoefficientNo{0U}; locatorCoefficientNo <= coefficientNo; locatorCoefficientNo++) {
+      evaluator[coefficientNo] ^= gf16::mul(syndromes[coefficientNo - locatorCoefficientNo], locator[locatorCoefficientNo]);
+    }
+  }
 
-  RS::Codeword codeword{};
+  for (uint8_t erasureNo{0U}; erasureNo < erasuresNo; erasureNo++) {
+    const auto inverseLocator{gf16::div(1U, erasureLocators[erasureNo])};
 
-  // lookup and correct time message (S0-SK0) errors using Reed-Solomon FEC data (ECC0-ECC2)
+    uint8_t evaluatorValue{0U};
+    for (auto coefficientNo{static_cast<int8_t>(erasuresNo - 1U)}; coefficientNo >= 0; coefficientNo--) {
+      evaluatorValue = static_cast<uint8_t>(gf16::mul(evaluatorValue, inverseLocator) ^ evaluator[coefficientNo]);
+    }
 
-  // 1. Get codeword from the time frame
-  {
-    auto codewordIndex{0U};
-    // not aligned bits S0-SK0
-    for (auto frameByteNo{3U}; frameByteNo < 8U; frameByteNo++) {
-      // get reminder of the previous symbol (stored in bits 7-5)
-      if (frameByteNo != 3U) {
-        codeword.at(codewordIndex++) += ((_timeFrame.at(frameByteNo) >> 5U) & 0x07);
-      }
-      // get full symbol in the middle of the byte (bits 4-1)
-      codeword.at(codewordIndex++) = ((_timeFrame.at(frameByteNo) >> 1U) & 0x0F);
-      // get MSb of the next symbol (stored in bit 0)
-      if (frameByteNo != 7U) {
-        codeword.at(codewordIndex) = ((_timeFrame.at(frameByteNo) & 0x01) << 3U);
-      }
+    // formal derivative in GF(2^m) keeps only odd powers
+    uint8_t locatorDerivativeValue{0U};
+    uint8_t inverseLocatorPower{1U};
+    for (uint8_t coefficientNo{1U}; coefficientNo <= erasuresNo; coefficientNo += 2U) {
+      locatorDerivativeValue ^= gf16::mul(locator[coefficientNo], inverseLocatorPower);
+      inverseLocatorPower = gf16::mul(inverseLocatorPower, gf16::mul(inverseLocator, inverseLocator));
     }
-    // aligned bits in bytes ECC0-ECC2
-    for (auto frameByteNo{8U}; frameByteNo < 11U; frameByteNo++) {
-      codeword.at(codewordIndex++) = ((_timeFrame.at(frameByteNo) >> 4U) & 0x0F);
-      codeword.at(codewordIndex++) = (_timeFrame.at(frameByteNo) & 0x0F);
+
+    if (locatorDerivativeValue == 0U) {
+      return AN_ERROR;
     }
-  }
 
-  // 2. Recover possibly faulty codeword
-  const auto recoveryError{_rs.recoverCodeword(codeword)};
-  if (recoveryError) {
-    return AN_ERROR;
+    codeword[erasedSymbolIndexes[erasureNo]] ^= gf16::div(evaluatorValue, locatorDerivativeValue);
   }
 
-  // 3. Update the time frame with corrected data
-  {
-    auto codewordIndex{0U};
-    // not aligned bits S0-SK0
-    for (auto frameByteNo{3U}; frameByteNo < 8U; frameByteNo++) {
-      uint8_t updatedFrameByte{0U};
-      // set 3 LSb reminder of the current symbol (on 1st pass keep original 3 MSb)
-      if (frameByteNo == 3U) {
-        updatedFrameByte = (_timeFrame.at(frameByteNo) &= 0xE0);
-      } else {
-        updatedFrameByte = ((codeword.at(codewordIndex++) & 0x07) << 5U);
+  return rsSyndromesIndicateErrors(calculateRsSyndromes(codeword));
+}
+
+void DataDecoderBase::findLeastConfident(const uint8_t* confidence, uint8_t itemsNo, uint8_t* indexes, uint8_t indexesNo) {
+  // indexes are ordered from the least confident item (ties keep the lower index first)
+  for (uint8_t foundNo{0U}; foundNo < indexesNo; foundNo++) {
+    uint8_t leastConfidentIndex{0U};
+    auto leastConfidence{static_cast<uint16_t>(UINT8_MAX + 1U)};
+
+    for (uint8_t itemIndex{0U}; itemIndex < itemsNo; itemIndex++) {
+      auto alreadyFound{false};
+      for (uint8_t foundIndexNo{0U}; foundIndexNo < foundNo; foundIndexNo++) {
+        alreadyFound = (alreadyFound or (indexes[foundIndexNo] == itemIndex));
       }
-      // set full symbol in the middle of the byte (bits 4-1)
-      updatedFrameByte |= (codeword.at(codewordIndex++) << 1U);
-      // set MSb of the next symbol as LSb of the time frame byte (preserve time frame LSb in byte 7)
-      if (frameByteNo == 7U) {
-        updatedFrameByte |= (_timeFrame.at(frameByteNo) &= 0x01);
-      } else {
-        updatedFrameByte |= ((codeword.at(codewordIndex) & 0x08) >> 3U);
+
+      if ((not alreadyFound) and (confidence[itemIndex] < leastConfidence)) {
+        leastConfidence = confidence[itemIndex];
+        leastConfidentIndex = itemIndex;
       }
-      _timeFrame.at(frameByteNo) = updatedFrameByte;
-    }
-    // aligned bits in bytes ECC0-ECC2
-    for (auto frameByteNo{8U}; frameByteNo < 11U; frameByteNo++) {
-      _timeFrame.at(frameByteNo) = (codeword.at(codewordIndex++) << 4U);
-      _timeFrame.at(frameByteNo) |= codeword.at(codewordIndex++);
     }
-  }
 
-  return NO_ERROR;
+    indexes[foundNo] = leastConfidentIndex;
+  }
 }
 
-void DataDecoder::descrambleTimeMessage() {
-  // descramble time message (37 bytes starting at byte 3 bit 4 until byte 7 bit 0; 3 MSb of scrambling word are 0 (0x0A) so they won't affect message's static part)
-  auto timeFrameByteNo{3U};
-  for (const auto scramblingByte : _scramblingWord) {
-    _timeFrame.at(timeFrameByteNo++) ^= scramblingByte;
-  }
+void DataDecoderBase::descrambleTimeMessage() {
+  ECZAS_TRACE_SCOPE(DescrambleTimeMessage);
+
+  // descramble time message (37 bits starting at byte 3 bit 4 until byte 7 bit 0; 3 MSb of scrambling word are 0 (0x0A) so they won't affect message's static part)
+  _timeFrame.toggle(SCRAMBLING_MASK);
 }
 
-void DataDecoder::extractTimeData() {
-  for (auto timeFrameByteNo{3U}; timeFrameByteNo < 8U; timeFrameByteNo++) {
-    // at the same time grab timestamp data
-    switch (timeFrameByteNo) {
-      case 3U:  // 5 LSb only
-        _timeData.utcTimestamp = (_timeFrame.at(timeFrameByteNo) & 0x1F);
-        break;
-      case 7U:  // MSb only
-        _timeData.utcTimestamp <<= 1U;
-        _timeData.utcTimestamp += ((_timeFrame.at(timeFrameByteNo) & 0x80) ? 1U : 0U);
-        break;
-      default:  // full byte
-        _timeData.utcTimestamp <<= 8U;
-        _timeData.utcTimestamp += _timeFrame.at(timeFrameByteNo);
-        break;
-    }
-  }
+void DataDecoderBase::extractTimeData() {
+  ECZAS_TRACE_SCOPE(ExtractTimeData);
+
+  _timeData.utcTimestamp = static_cast<uint32_t>(_timeFrame.get(PackedTimeFrame::TIMESTAMP));
 
   // correct received timestamp as it means the number of 3[s] periods since beginning of the year 2000
   static constexpr uint32_t secondsBetweenYear1970And2000{946684800U};
@@ -437,71 +322,44 @@ void DataDecoder::extractTimeData() {
   _timeData.utcTimestamp *= 3U;
   _timeData.utcUnixTimestamp = _timeData.utcTimestamp + secondsBetweenYear1970And2000;
 
-  // get the local time offset (bits TZ0 (6) and TZ1 (5)) - this should be sent other way around for simpler decoding
-  const auto timeOffset{static_cast<uint8_t>((_timeFrame.at(7U) >> 5) & 0x03)};
-  switch (timeOffset) {
-    case 0x01:
-      _timeData.offset = TimeZoneOffset::OffsetPlus2h;
-      break;
-    case 0x02:
-      _timeData.offset = TimeZoneOffset::OffsetPlus1h;
-      break;
-    case 0x03:
-      _timeData.offset = TimeZoneOffset::OffsetPlus3h;
-      break;
-    default:
-      _timeData.offset = TimeZoneOffset::OffsetPlus0h;
-      break;
-  }
+  // get the local time offset (bits TZ0 and TZ1) - this should be sent other way around for simpler decoding
+  static constexpr std::array<TimeZoneOffset, 4U> TIME_ZONE_OFFSETS{TimeZoneOffset::OffsetPlus0h, TimeZoneOffset::OffsetPlus2h, TimeZoneOffset::OffsetPlus1h,
+                                                                    TimeZoneOffset::OffsetPlus3h};
+  _timeData.offset = TIME_ZONE_OFFSETS[_timeFrame.get(PackedTimeFrame::TIME_ZONE)];
 
-  // get time zone change announcement (bit TZC(2))
-  _timeData.timeZoneChangeAnnouncement = ((static_cast<uint8_t>(_timeFrame.at(7U) >> 2U) & 0x01) ? true : false);
-
-  // extract leap second related information (bits LS(4) and LSS(3))
-  _timeData.leapSecondAnnounced = ((static_cast<uint8_t>(_timeFrame.at(7U) >> 4U) & 0x01) ? true : false);
-  _timeData.leapSecondPositive = ((static_cast<uint8_t>(_timeFrame.at(7U) >> 3U) & 0x01) ? true : false);
-
-  // extract transmitter state (bits SK0 (1) and SK1 (0)) - this should be sent other way around for simpler decoding
-  const auto transmitterState{static_cast<uint8_t>(_timeFrame.at(7U) & 0x03)};
-  switch (transmitterState) {
-    case 0x01:
-      _timeData.transmitterState = TransmitterState::PlannedMaintenance1Week;
-      break;
-    case 0x02:
-      _timeData.transmitterState = TransmitterState::PlannedMaintenance1Day;
-      break;
-    case 0x03:
-      _timeData.transmitterState = TransmitterState::PlannedMaintenanceOver1Week;
-      break;
-    default:
-      _timeData.transmitterState = TransmitterState::NormalOperation;
-      break;
-  }
-}
+  // get time zone change announcement (bit TZC)
+  _timeData.timeZoneChangeAnnouncement = static_cast<bool>(_timeFrame.get(PackedTimeFrame::TIME_ZONE_CHANGE_ANNOUNCEMENT));
 
-bool DataDecoder::validateCrc() {
-  static constexpr bool NO_ERROR{false};
-  static constexpr bool AN_ERROR{true};
+  // extract leap second related information (bits LS and LSS)
+  _timeData.leapSecondAnnounced = static_cast<bool>(_timeFrame.get(PackedTimeFrame::LEAP_SECOND_ANNOUNCEMENT));
+  _timeData.leapSecondPositive = static_cast<bool>(_timeFrame.get(PackedTimeFrame::LEAP_SECOND_SIGN));
 
-  // Time frame byte 11 contain CRC8 hash calculated over data bytes 3-7
+  // extract transmitter state (bits SK0 and SK1) - this should be sent other way around for simpler decoding
+  static constexpr std::array<TransmitterState, 4U> TRANSMITTER_STATES{TransmitterState::NormalOperation, TransmitterState::PlannedMaintenance1Week,
+                                                                       TransmitterState::PlannedMaintenance1Day, TransmitterState::PlannedMaintenanceOver1Week};
+  _timeData.transmitterState = TRANSMITTER_STATES[_timeFrame.get(PackedTimeFrame::TRANSMITTER_STATE)];
+}
 
-  crc::CRC8 crc{CRC8_POLYNOMIAL, CRC8_INIT_VALUE};
+uint8_t DataDecoderBase::calculateCrcSyndrome() const {
+  // Time frame byte 11 contain CRC8 hash calculated over data bytes 3-7 (zero syndrome means the data matches the hash)
 
-  for (auto byteNo{3U}; byteNo < 8U; byteNo++) {
-    crc.update(_timeFrame.at(byteNo));
-  }
+  return static_cast<uint8_t>(crc8::calculate<CRC8_POLYNOMIAL>(_timeFrame.get(PackedTimeFrame::CRC_DATA), CRC8_DATA_BYTES_NO, CRC8_INIT_VALUE) ^
+                              _timeFrame.get(PackedTimeFrame::CRC));
+}
 
-  if ((crc.get() != _timeFrame.at(11))) {
-    return AN_ERROR;
-  }
+bool DataDecoderBase::isCrcValid() const {
+  // time frame data matches CRC8 as received or with SK1 flipped (repaired later by correctSk1ErrorWithCrc()) - time frame is not modified
+  const auto syndrome{calculateCrcSyndrome()};
 
-  return NO_ERROR;
+  return ((syndrome == 0U) or (syndrome == SK1_ERROR_SIGNATURE));
 }
 
-bool DataDecoder::correctSk1ErrorWithCrc() {
+bool DataDecoderBase::correctSk1ErrorWithCrc() {
   static constexpr bool NO_ERROR{false};
   static constexpr bool AN_ERROR{true};
 
+  ECZAS_TRACE_SCOPE(CorrectSk1ErrorWithCrc);
+
   /* After successful time frame data retrieval with Reed-Solomon the only data bit left, not covered with FEC, is SK1.
      Out of time frame bytes 3-7 the only unknown information is SK1 (0x101 in byte 3 is static and validated already).
      CRC8 may be calculated from data with SK1 bit value as received and also with its value being flipped.
@@ -509,23 +367,28 @@ bool DataDecoder::correctSk1ErrorWithCrc() {
      In case of SK1 retrieval failure it is to be decided by the app if whole time frame should be discarded or the transmitter state
      should be marked as unknown (SK0-SK1). */
 
-  crc::CRC8 crc{CRC8_POLYNOMIAL, CRC8_INIT_VALUE};
+  const auto syndrome{calculateCrcSyndrome()};
 
   // 1. Validate received CRC against the time frame data (3-7) as is
-  if (not validateCrc()) {
+  if (syndrome == 0U) {
     return NO_ERROR;
   }
 
-  // 2. If no success flip SK1 (LSb) bit and check again
-  _timeFrame.at(7) ^= 0x01;
-  if (not validateCrc()) {
+  // 2. If no success check if flipped SK1 (LSb) bit would explain the syndrome (CRC is linear so no recalculation is needed)
+  if (syndrome == SK1_ERROR_SIGNATURE) {
+    _timeFrame.set(PackedTimeFrame::SK1, _timeFrame.get(PackedTimeFrame::SK1) ^ 0x01);
+    incrementCounter(_statistics.sk1RepairsNo);
     return NO_ERROR;
   }
 
-  // 3. If still no success revert SK1 value to leave the timeFrame in an original form
-  _timeFrame.at(7) ^= 0x01;
-
+  // 3. If still no success leave the timeFrame in an original form
   return AN_ERROR;
 }
 
+// stream buffer sizes used by the applications in both storage modes (declared extern in DataDecoder.hpp - keep both lists in sync)
+template class BasicDataDecoder<512U, DataDecoderBase::StreamStorage::Full>;
+template class BasicDataDecoder<512U, DataDecoderBase::StreamStorage::Compact>;
+template class BasicDataDecoder<1024U, DataDecoderBase::StreamStorage::Full>;
+template class BasicDataDecoder<1024U, DataDecoderBase::StreamStorage::Compact>;
+
 }  // namespace eczas
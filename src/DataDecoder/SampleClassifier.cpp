@@ -0,0 +1,151 @@
+/**
+ * @file SampleClassifier.cpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <DataDecoder/SampleClassifier.hpp>
+
+#include <stdint.h>
+#include <cstddef>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define ECZAS_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace eczas {
+
+namespace {
+
+void classifyScalar(const int16_t* samples, size_t samplesNo, int16_t noiseHysteresis, uint64_t* significant, uint64_t* positive) {
+  for (size_t wordNo{0U}; wordNo < SampleClassifier::getWordsNo(samplesNo); wordNo++) {
+    const auto wordStart{wordNo * SampleClassifier::SAMPLES_PER_WORD};
+    const auto wordSamplesNo{((samplesNo - wordStart) < SampleClassifier::SAMPLES_PER_WORD) ? (samplesNo - wordStart) : SampleClassifier::SAMPLES_PER_WORD};
+
+    uint64_t significantWord{0U};
+    uint64_t positiveWord{0U};
+
+    // branchless to let the compiler vectorize it when possible
+    for (size_t sampleNo{0U}; sampleNo < wordSamplesNo; sampleNo++) {
+      const auto sample{samples[wordStart + sampleNo]};
+      significantWord |= (static_cast<uint64_t>((sample > noiseHysteresis) | (sample < -noiseHysteresis)) << sampleNo);
+      positiveWord |= (static_cast<uint64_t>(sample > 0) << sampleNo);
+    }
+
+    significant[wordNo] = significantWord;
+    positive[wordNo] = positiveWord;
+  }
+}
+
+#ifdef ECZAS_X86_KERNELS
+
+__attribute__((target("sse2"))) void classifySse2(const int16_t* samples, size_t samplesNo, int16_t noiseHysteresis, uint64_t* significant, uint64_t* positive) {
+  static constexpr size_t SAMPLES_PER_STEP{16U};
+
+  const auto upperThreshold{_mm_set1_epi16(noiseHysteresis)};
+  const auto lowerThreshold{_mm_set1_epi16(static_cast<int16_t>(-noiseHysteresis))};
+  const auto zero{_mm_setzero_si128()};
+
+  const auto fullWordsNo{samplesNo / SampleClassifier::SAMPLES_PER_WORD};
+
+  for (size_t wordNo{0U}; wordNo < fullWordsNo; wordNo++) {
+    uint64_t significantWord{0U};
+    uint64_t positiveWord{0U};
+
+    for (size_t stepNo{0U}; stepNo < (SampleClassifier::SAMPLES_PER_WORD / SAMPLES_PER_STEP); stepNo++) {
+      const auto* stepSamples{samples + (wordNo * SampleClassifier::SAMPLES_PER_WORD) + (stepNo * SAMPLES_PER_STEP)};
+      const auto lowerHalf{_mm_loadu_si128(reinterpret_cast<const __m128i*>(stepSamples))};
+      const auto upperHalf{_mm_loadu_si128(reinterpret_cast<const __m128i*>(stepSamples + 8U))};
+
+      // 16 bit comparison results are saturated into bytes to get one mask bit per sample
+      const auto significantMask{_mm_packs_epi16(_mm_or_si128(_mm_cmpgt_epi16(lowerHalf, upperThreshold), _mm_cmplt_epi16(lowerHalf, lowerThreshold)),
+        _mm_or_si128(_mm_cmpgt_epi16(upperHalf, upperThreshold), _mm_cmplt_epi16(upperHalf, lowerThreshold)))};
+      const auto positiveMask{_mm_packs_epi16(_mm_cmpgt_epi16(lowerHalf, zero), _mm_cmpgt_epi16(upperHalf, zero))};
+
+      significantWord |= (static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(significantMask))) << (stepNo * SAMPLES_PER_STEP));
+      positiveWord |= (static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(positiveMask))) << (stepNo * SAMPLES_PER_STEP));
+    }
+
+    significant[wordNo] = significantWord;
+    positive[wordNo] = positiveWord;
+  }
+
+  // the remainder (partial word)
+  const auto processedSamplesNo{fullWordsNo * SampleClassifier::SAMPLES_PER_WORD};
+  classifyScalar(samples + processedSamplesNo, samplesNo - processedSamplesNo, noiseHysteresis, significant + fullWordsNo, positive + fullWordsNo);
+}
+
+__attribute__((target("avx2"))) void classifyAvx2(const int16_t* samples, size_t samplesNo, int16_t noiseHysteresis, uint64_t* significant, uint64_t* positive) {
+  static constexpr size_t SAMPLES_PER_STEP{32U};
+
+  const auto upperThreshold{_mm256_set1_epi16(noiseHysteresis)};
+  const auto lowerThreshold{_mm256_set1_epi16(static_cast<int16_t>(-noiseHysteresis))};
+  const auto zero{_mm256_setzero_si256()};
+
+  const auto fullWordsNo{samplesNo / SampleClassifier::SAMPLES_PER_WORD};
+
+  for (size_t wordNo{0U}; wordNo < fullWordsNo; wordNo++) {
+    uint64_t significantWord{0U};
+    uint64_t positiveWord{0U};
+
+    for (size_t stepNo{0U}; stepNo < (SampleClassifier::SAMPLES_PER_WORD / SAMPLES_PER_STEP); stepNo++) {
+      const auto* stepSamples{samples + (wordNo * SampleClassifier::SAMPLES_PER_WORD) + (stepNo * SAMPLES_PER_STEP)};
+      const auto lowerHalf{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(stepSamples))};
+      const auto upperHalf{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(stepSamples + 16U))};
+
+      const auto lowerSignificant{_mm256_or_si256(_mm256_cmpgt_epi16(lowerHalf, upperThreshold), _mm256_cmpgt_epi16(lowerThreshold, lowerHalf))};
+      const auto upperSignificant{_mm256_or_si256(_mm256_cmpgt_epi16(upperHalf, upperThreshold), _mm256_cmpgt_epi16(lowerThreshold, upperHalf))};
+
+      // packing works within 128 bit lanes so 64 bit blocks have to be put back in sample order
+      const auto significantMask{_mm256_permute4x64_epi64(_mm256_packs_epi16(lowerSignificant, upperSignificant), 0xD8)};
+      const auto positiveMask{_mm256_permute4x64_epi64(_mm256_packs_epi16(_mm256_cmpgt_epi16(lowerHalf, zero), _mm256_cmpgt_epi16(upperHalf, zero)), 0xD8)};
+
+      significantWord |= (static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(significantMask))) << (stepNo * SAMPLES_PER_STEP));
+      positiveWord |= (static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(positiveMask))) << (stepNo * SAMPLES_PER_STEP));
+    }
+
+    significant[wordNo] = significantWord;
+    positive[wordNo] = positiveWord;
+  }
+
+  // compiler doesn't clear upper halves of AVX registers before the tail call, legacy SSE code executed afterwards would pay for state transition
+  _mm256_zeroupper();
+
+  // the remainder (partial word)
+  const auto processedSamplesNo{fullWordsNo * SampleClassifier::SAMPLES_PER_WORD};
+  classifyScalar(samples + processedSamplesNo, samplesNo - processedSamplesNo, noiseHysteresis, significant + fullWordsNo, positive + fullWordsNo);
+}
+
+#endif
+
+}  // namespace
+
+SampleClassifier::SampleClassifier(uint16_t noiseHysteresis)
+  : _noiseHysteresis(static_cast<int16_t>(noiseHysteresis)), _kernel(classifyScalar), _kernelName("scalar") {
+#ifdef ECZAS_X86_KERNELS
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    _kernel = classifyAvx2;
+    _kernelName = "avx2";
+  } else if (__builtin_cpu_supports("sse2")) {
+    _kernel = classifySse2;
+    _kernelName = "sse2";
+  }
+#endif
+}
+
+void SampleClassifier::classify(const int16_t* samples, size_t samplesNo, uint64_t* significant, uint64_t* positive) const {
+  _kernel(samples, samplesNo, _noiseHysteresis, significant, positive);
+}
+
+const char* SampleClassifier::getKernelName() const {
+  return _kernelName;
+}
+
+}  // namespace eczas
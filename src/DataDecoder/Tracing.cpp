@@ -0,0 +1,167 @@
+/**
+ * @file Tracing.cpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <DataDecoder/Tracing.hpp>
+
+#include <unistd.h>
+
+namespace eczas {
+namespace tracing {
+
+namespace {
+
+static constexpr size_t STAGES_NO{static_cast<size_t>(Stage::StagesNo)};
+
+static constexpr const char* STAGE_NAMES[STAGES_NO]{
+  "getTimeFrameDataFromStream",
+  "validateTimeFrameStaticFields",
+  "correctTimeFrameErrorsWithRsFec",
+  "correctTimeFrameErrorsWithSoftDecisions",
+  "correctSk1ErrorWithCrc",
+  "descrambleTimeMessage",
+  "extractTimeData",
+  "sampleToTimeData",
+};
+
+#ifdef ECZAS_TRACING_TSC_USED
+static constexpr const char* DURATION_UNIT{"cycles"};
+#else
+static constexpr const char* DURATION_UNIT{"ns"};
+#endif
+
+std::array<Histogram, STAGES_NO> histograms{};
+
+/// Text is formatted in a fixed size buffer on the stack (nothing is allocated so it's safe to use in a signal handler)
+class DumpBuffer {
+public:
+  explicit DumpBuffer(int fd) : _fd(fd) {}
+
+  ~DumpBuffer() {
+    flush();
+  }
+
+  void append(const char* text) {
+    while (*text) {
+      if (_size == _buffer.size()) {
+        flush();
+      }
+      _buffer[_size++] = *text++;
+    }
+  }
+
+  void appendDecimal(uint64_t value) {
+    std::array<char, 21U> digits{};
+    auto digitIndex{digits.size() - 1U};
+
+    do {
+      digits[--digitIndex] = static_cast<char>('0' + (value % 10U));
+      value /= 10U;
+    } while (value != 0U);
+
+    append(&digits[digitIndex]);
+  }
+
+  void flush() {
+    size_t writtenBytesNo{0U};
+
+    while (writtenBytesNo < _size) {
+      const auto result{write(_fd, _buffer.data() + writtenBytesNo, _size - writtenBytesNo)};
+      if (result <= 0) {
+        break;
+      }
+      writtenBytesNo += static_cast<size_t>(result);
+    }
+
+    _size = 0U;
+  }
+
+private:
+  const int _fd;
+
+  std::array<char, 1024U> _buffer{};
+
+  size_t _size{0U};
+};
+
+}  // namespace
+
+void record(Stage stage, uint64_t duration) {
+  auto& histogram{histograms[static_cast<size_t>(stage)]};
+
+  // bucket is given by the duration bit width
+  const auto bitWidth{(duration == 0U) ? 0U : static_cast<uint32_t>(64 - __builtin_clzll(duration))};
+  const auto bucketNo{(bitWidth < HISTOGRAM_BUCKETS_NO) ? bitWidth : (HISTOGRAM_BUCKETS_NO - 1U)};
+
+  histogram.count.fetch_add(1U, std::memory_order_relaxed);
+  histogram.sum.fetch_add(duration, std::memory_order_relaxed);
+  histogram.buckets[bucketNo].fetch_add(1U, std::memory_order_relaxed);
+
+  auto min{histogram.min.load(std::memory_order_relaxed)};
+  while ((duration < min) and not histogram.min.compare_exchange_weak(min, duration, std::memory_order_relaxed)) {
+  }
+
+  auto max{histogram.max.load(std::memory_order_relaxed)};
+  while ((duration > max) and not histogram.max.compare_exchange_weak(max, duration, std::memory_order_relaxed)) {
+  }
+}
+
+const Histogram& getHistogram(Stage stage) {
+  return histograms[static_cast<size_t>(stage)];
+}
+
+void dump(int fd) {
+  DumpBuffer output{fd};
+
+  output.append("\nLatency histograms (");
+  output.append(DURATION_UNIT);
+  output.append(", bucket: <upper limit>:<count>)\n");
+
+  for (size_t stageNo{0U}; stageNo < STAGES_NO; stageNo++) {
+    const auto& histogram{histograms[stageNo]};
+    const auto count{histogram.count.load(std::memory_order_relaxed)};
+
+    output.append(STAGE_NAMES[stageNo]);
+    output.append(": count ");
+    output.appendDecimal(count);
+
+    if (count != 0U) {
+      output.append(", mean ");
+      output.appendDecimal(histogram.sum.load(std::memory_order_relaxed) / count);
+      output.append(", min ");
+      output.appendDecimal(histogram.min.load(std::memory_order_relaxed));
+      output.append(", max ");
+      output.appendDecimal(histogram.max.load(std::memory_order_relaxed));
+      output.append("\n ");
+
+      for (uint8_t bucketNo{0U}; bucketNo < HISTOGRAM_BUCKETS_NO; bucketNo++) {
+        const auto bucketCount{histogram.buckets[bucketNo].load(std::memory_order_relaxed)};
+        if (bucketCount == 0U) {
+          continue;
+        }
+
+        // the last bucket has no upper limit
+        output.append(" <");
+        if (bucketNo == (HISTOGRAM_BUCKETS_NO - 1U)) {
+          output.append("inf");
+        } else {
+          output.appendDecimal(1ULL << bucketNo);
+        }
+        output.append(":");
+        output.appendDecimal(bucketCount);
+      }
+    }
+
+    output.append("\n");
+  }
+}
+
+}  // namespace tracing
+}  // namespace eczas
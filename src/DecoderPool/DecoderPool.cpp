@@ -0,0 +1,203 @@
+/**
+ * @file DecoderPool.cpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <DecoderPool/DecoderPool.hpp>
+
+#include <algorithm>
+
+namespace eczas {
+
+DecoderPool::DecoderPool(size_t threadsNo, OverflowPolicy overflowPolicy) : _overflowPolicy(overflowPolicy) {
+  if (threadsNo == 0U) {
+    threadsNo = 1U;
+  }
+
+  for (size_t threadNo{0U}; threadNo < threadsNo; threadNo++) {
+    _workers.emplace_back(&DecoderPool::workerLoop, this);
+  }
+}
+
+DecoderPool::~DecoderPool() {
+  waitIdle();
+
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _stopping = true;
+  }
+  _workAvailable.notify_all();
+
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+DecoderPool::ChannelId DecoderPool::addChannel(uint8_t streamSamplesPerBit) {
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  _channels.push_back(std::make_unique<Channel>(streamSamplesPerBit));
+
+  return (_channels.size() - 1U);
+}
+
+DataDecoder& DecoderPool::getDecoder(ChannelId channelId) {
+  return getChannel(channelId).decoder;
+}
+
+bool DecoderPool::pushSamples(ChannelId channelId, const int16_t* samples, size_t samplesNo) {
+  static constexpr bool NO_ERROR{false};
+  static constexpr bool AN_ERROR{true};
+
+  auto& channel{getChannel(channelId)};
+
+  for (size_t queuedSamplesNo{0U}; queuedSamplesNo < samplesNo;) {
+    auto block{channel.blocks.getFreeSlot()};
+
+    if (block == nullptr) {
+      std::unique_lock<std::mutex> lock{channel.mutex};
+
+      if (_overflowPolicy == OverflowPolicy::Drop) {
+        channel.droppedSamplesNo += (samplesNo - queuedSamplesNo);
+        return AN_ERROR;
+      }
+
+      // queue is full only when the channel is scheduled so its worker is going to make room
+      channel.roomAvailable.wait(lock, [&channel, &block]() {
+        block = channel.blocks.getFreeSlot();
+        return (block != nullptr);
+      });
+    }
+
+    // free block is never touched by workers so it's filled without any lock
+    const auto blockSamplesNo{std::min(samplesNo - queuedSamplesNo, SAMPLES_BLOCK_SIZE)};
+    block->samplesNo = blockSamplesNo;
+    std::copy(samples + queuedSamplesNo, samples + queuedSamplesNo + blockSamplesNo, block->samples.begin());
+    channel.blocks.push();
+    queuedSamplesNo += blockSamplesNo;
+
+    // channel already scheduled will pick up new block on its own
+    bool schedulingNeeded{false};
+    {
+      std::lock_guard<std::mutex> lock{channel.mutex};
+      schedulingNeeded = not channel.scheduled;
+      channel.scheduled = true;
+    }
+
+    if (schedulingNeeded) {
+      scheduleChannel(channelId);
+    }
+  }
+
+  return NO_ERROR;
+}
+
+void DecoderPool::waitIdle() {
+  std::unique_lock<std::mutex> lock{_mutex};
+
+  _idle.wait(lock, [this]() { return (_readyChannels.empty() and (_busyWorkersNo == 0U)); });
+}
+
+DataDecoder::ProcessingResult DecoderPool::getProcessingResult(ChannelId channelId) {
+  auto& channel{getChannel(channelId)};
+  std::lock_guard<std::mutex> lock{channel.mutex};
+
+  return channel.processingResult;
+}
+
+size_t DecoderPool::getDroppedSamplesNo(ChannelId channelId) {
+  auto& channel{getChannel(channelId)};
+  std::lock_guard<std::mutex> lock{channel.mutex};
+
+  return channel.droppedSamplesNo;
+}
+
+DecoderPool::Channel& DecoderPool::getChannel(ChannelId channelId) {
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  return *_channels.at(channelId);
+}
+
+void DecoderPool::scheduleChannel(ChannelId channelId) {
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  _readyChannels.push_back(channelId);
+  _workAvailable.notify_one();
+}
+
+void DecoderPool::workerLoop() {
+  std::unique_lock<std::mutex> lock{_mutex};
+
+  for (;;) {
+    _workAvailable.wait(lock, [this]() { return (_stopping or not _readyChannels.empty()); });
+
+    if (_readyChannels.empty()) {
+      // stopping and there is nothing left to do
+      return;
+    }
+
+    const auto channelId{_readyChannels.front()};
+    _readyChannels.pop_front();
+
+    auto& channel{*_channels[channelId]};
+    _busyWorkersNo++;
+
+    lock.unlock();
+
+    // the channel stays scheduled so no other worker touches its decoder and queue (up to a queue of blocks is processed per turn)
+    DataDecoder::ProcessingResult processingResult{};
+    for (size_t blockNo{0U}; blockNo < CHANNEL_QUEUE_SIZE; blockNo++) {
+      const auto block{channel.blocks.getFront()};
+      if (block == nullptr) {
+        break;
+      }
+
+      const auto blockResult{channel.decoder.processSamples(block->samples.data(), block->samplesNo)};
+
+      processingResult.samplesNo += blockResult.samplesNo;
+      processingResult.overrunsNo += blockResult.overrunsNo;
+      processingResult.timeFramesNo += blockResult.timeFramesNo;
+
+      // processed block is free for the following samples (producer waiting for room checks the queue under the channel's lock)
+      {
+        std::lock_guard<std::mutex> channelLock{channel.mutex};
+        channel.blocks.pop();
+      }
+      channel.roomAvailable.notify_one();
+    }
+
+    // blocks pushed in the meantime are processed in the next turn (other channels get their share first)
+    bool reschedulingNeeded{false};
+    {
+      std::lock_guard<std::mutex> channelLock{channel.mutex};
+
+      channel.processingResult.samplesNo += processingResult.samplesNo;
+      channel.processingResult.overrunsNo += processingResult.overrunsNo;
+      channel.processingResult.timeFramesNo += processingResult.timeFramesNo;
+
+      reschedulingNeeded = not channel.blocks.isEmpty();
+      channel.scheduled = reschedulingNeeded;
+    }
+
+    lock.lock();
+
+    if (reschedulingNeeded) {
+      _readyChannels.push_back(channelId);
+      _workAvailable.notify_one();
+    }
+
+    _busyWorkersNo--;
+
+    if (_readyChannels.empty() and (_busyWorkersNo == 0U)) {
+      _idle.notify_all();
+    }
+  }
+}
+
+}  // namespace eczas
@@ -0,0 +1,253 @@
+/**
+ * @file SignalGenerator.cpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <SignalGenerator/SignalGenerator.hpp>
+#include <DataDecoder/Crc8.hpp>
+#include <DataDecoder/Gf16.hpp>
+
+#include <stdint.h>
+#include <array>
+
+namespace eczas {
+
+namespace {
+
+/// RS(15,9) generator polynomial (x + x^1)(x + x^2)...(x + x^6) coefficients, starting with x^0 (x^6 coefficient is 1)
+constexpr std::array<uint8_t, DataDecoder::RS_PARITY_SYMBOLS_NO> RS_GENERATOR{[]() {
+  std::array<uint8_t, DataDecoder::RS_PARITY_SYMBOLS_NO + 1U> generator{1U};
+  for (uint8_t rootNo{1U}; rootNo <= DataDecoder::RS_PARITY_SYMBOLS_NO; rootNo++) {
+    const auto root{gf16::pow(rootNo)};
+    for (auto coefficientNo{rootNo}; coefficientNo > 0U; coefficientNo--) {
+      generator[coefficientNo] = static_cast<uint8_t>(generator[coefficientNo - 1U] ^ gf16::mul(generator[coefficientNo], root));
+    }
+    generator[0] = gf16::mul(generator[0], root);
+  }
+
+  std::array<uint8_t, DataDecoder::RS_PARITY_SYMBOLS_NO> coefficients{};
+  for (uint8_t coefficientNo{0U}; coefficientNo < DataDecoder::RS_PARITY_SYMBOLS_NO; coefficientNo++) {
+    coefficients[coefficientNo] = generator[coefficientNo];
+  }
+  return coefficients;
+}()};
+
+uint8_t getFrameBits(const DataDecoder::TimeFrame& timeFrame, uint8_t firstBitNo, uint8_t bitsNo) {
+  uint8_t bits{0U};
+  for (auto bitNo{firstBitNo}; bitNo < (firstBitNo + bitsNo); bitNo++) {
+    bits = static_cast<uint8_t>((bits << 1U) | ((timeFrame[bitNo / 8U] >> (7U - (bitNo % 8U))) & 0x01));
+  }
+  return bits;
+}
+
+void setFrameBits(DataDecoder::TimeFrame& timeFrame, uint8_t firstBitNo, uint8_t bitsNo, uint8_t bits) {
+  for (uint8_t bitOffset{0U}; bitOffset < bitsNo; bitOffset++) {
+    const auto bitNo{static_cast<uint8_t>(firstBitNo + bitOffset)};
+    const auto mask{static_cast<uint8_t>(0x80 >> (bitNo % 8U))};
+    if ((bits >> (bitsNo - 1U - bitOffset)) & 0x01) {
+      timeFrame[bitNo / 8U] |= mask;
+    } else {
+      timeFrame[bitNo / 8U] &= static_cast<uint8_t>(~mask);
+    }
+  }
+}
+
+}  // namespace
+
+SignalGenerator::SignalGenerator(const Config& config)
+  : _config(config),
+    _positionStep(static_cast<uint64_t>((static_cast<double>(1ULL << POSITION_FRACTION_BITS) * 1e6) / (1e6 + config.clockDriftPpm))),
+    _framePeriodSamplesNo(static_cast<uint32_t>(DataDecoder::FRAME_PERIOD_BITS * config.samplesPerBit)),
+    _pulseSamplesNo(static_cast<uint8_t>((config.samplesPerBit + 1U) / 2U)),
+    _randomState((config.seed == 0U) ? 1U : config.seed) {}
+
+void SignalGenerator::generate(int16_t* samples, size_t samplesNo) {
+  for (size_t sampleNo{0U}; sampleNo < samplesNo; sampleNo++) {
+    const auto transmitterSampleNo{_position >> POSITION_FRACTION_BITS};
+    const auto frameNo{transmitterSampleNo / _framePeriodSamplesNo};
+    const auto frameSampleNo{static_cast<uint32_t>(transmitterSampleNo % _framePeriodSamplesNo)};
+    const auto bitNo{frameSampleNo / _config.samplesPerBit};
+    const auto bitSampleNo{frameSampleNo % _config.samplesPerBit};
+
+    if (frameNo != _pulsesFrameNo) {
+      preparePulses(frameNo);
+    }
+
+    // phase change shows up as a pulse at the beginning of the bit
+    int32_t sample{0};
+    if ((bitNo < FRAME_PULSES_NO) and (bitSampleNo < _pulseSamplesNo)) {
+      sample = _pulses[bitNo] * _config.amplitude;
+    }
+
+    // triangular distribution noise (sum of two uniform ones)
+    if (_config.noiseAmplitude) {
+      const auto random{getRandom()};
+      const auto noise{static_cast<int32_t>(random & 0xFFFF) + static_cast<int32_t>(random >> 16U) - 0x10000};
+      sample += ((noise * _config.noiseAmplitude) / 0x10000);
+    }
+
+    samples[sampleNo] = static_cast<int16_t>((sample > INT16_MAX) ? INT16_MAX : ((sample < INT16_MIN) ? INT16_MIN : sample));
+
+    _position += _positionStep;
+  }
+
+  _generatedSamplesNo += samplesNo;
+}
+
+uint64_t SignalGenerator::getGeneratedSamplesNo() const {
+  return _generatedSamplesNo;
+}
+
+bool SignalGenerator::isTimeFrame(uint64_t frameNo) const {
+  return ((_config.timeFramesPeriod == 0U) or ((frameNo % _config.timeFramesPeriod) == 0U));
+}
+
+uint64_t SignalGenerator::getFrameStartSampleNo(uint64_t frameNo) const {
+  // the 1st generated sample which position is not before the frame start
+  const auto frameStartPosition{static_cast<unsigned __int128>(frameNo * _framePeriodSamplesNo) << POSITION_FRACTION_BITS};
+  return static_cast<uint64_t>((frameStartPosition + _positionStep - 1U) / _positionStep);
+}
+
+DataDecoder::TimeData SignalGenerator::getTimeData(uint64_t frameNo) const {
+  DataDecoder::TimeData timeData{};
+
+  const auto firstFrameTimestamp{((_config.utcUnixTimestamp - SECONDS_BETWEEN_YEAR_1970_AND_2000) / FRAME_PERIOD_SECONDS) * FRAME_PERIOD_SECONDS};
+
+  timeData.utcTimestamp = static_cast<uint32_t>(firstFrameTimestamp + (frameNo * FRAME_PERIOD_SECONDS));
+  timeData.utcUnixTimestamp = timeData.utcTimestamp + SECONDS_BETWEEN_YEAR_1970_AND_2000;
+  timeData.offset = _config.offset;
+  timeData.timeZoneChangeAnnouncement = _config.timeZoneChangeAnnouncement;
+  timeData.leapSecondAnnounced = _config.leapSecondAnnounced;
+  timeData.leapSecondPositive = _config.leapSecondPositive;
+  timeData.transmitterState = _config.transmitterState;
+
+  return timeData;
+}
+
+DataDecoder::TimeFrame SignalGenerator::encodeTimeFrame(const DataDecoder::TimeData& timeData) {
+  DataDecoder::TimeFrame timeFrame{};
+
+  // 1. Static fields
+  timeFrame[0] = static_cast<uint8_t>(DataDecoder::SYNC_WORD >> 8U);
+  timeFrame[1] = static_cast<uint8_t>(DataDecoder::SYNC_WORD & 0x00FF);
+  timeFrame[2] = DataDecoder::TIME_FRAME_START_BYTE;
+
+  // 2. Time message: 30 bit number of 3[s] periods since beginning of the year 2000 followed by flags
+  const auto periodsNo{timeData.utcTimestamp / FRAME_PERIOD_SECONDS};
+
+  uint8_t timeOffset{0x00};
+  switch (timeData.offset) {
+    case DataDecoder::TimeZoneOffset::OffsetPlus1h:
+      timeOffset = 0x02;
+      break;
+    case DataDecoder::TimeZoneOffset::OffsetPlus2h:
+      timeOffset = 0x01;
+      break;
+    case DataDecoder::TimeZoneOffset::OffsetPlus3h:
+      timeOffset = 0x03;
+      break;
+    default:
+      break;
+  }
+
+  uint8_t transmitterState{0x00};
+  switch (timeData.transmitterState) {
+    case DataDecoder::TransmitterState::PlannedMaintenance1Week:
+      transmitterState = 0x01;
+      break;
+    case DataDecoder::TransmitterState::PlannedMaintenance1Day:
+      transmitterState = 0x02;
+      break;
+    case DataDecoder::TransmitterState::PlannedMaintenanceOver1Week:
+      transmitterState = 0x03;
+      break;
+    default:
+      break;
+  }
+
+  timeFrame[3] = static_cast<uint8_t>((DataDecoder::TIME_MESSAGE_PREFIX << 5U) | ((periodsNo >> 25U) & 0x1F));
+  timeFrame[4] = static_cast<uint8_t>(periodsNo >> 17U);
+  timeFrame[5] = static_cast<uint8_t>(periodsNo >> 9U);
+  timeFrame[6] = static_cast<uint8_t>(periodsNo >> 1U);
+  timeFrame[7] = static_cast<uint8_t>(((periodsNo & 0x01) << 7U) | (timeOffset << 5U) | (timeData.leapSecondAnnounced ? 0x10 : 0x00) |
+                                      (timeData.leapSecondPositive ? 0x08 : 0x00) | (timeData.timeZoneChangeAnnouncement ? 0x04 : 0x00) | transmitterState);
+
+  // 3. Scrambling
+  auto timeFrameByteNo{3U};
+  for (const auto scramblingByte : DataDecoder::SCRAMBLING_WORD) {
+    timeFrame[timeFrameByteNo++] ^= scramblingByte;
+  }
+
+  // 4. Reed-Solomon ECC and CRC8 are calculated over the scrambled time message
+  encodeRsParity(timeFrame);
+
+  timeFrame[DataDecoder::CRC8_BYTE] =
+    crc8::calculate<DataDecoder::CRC8_POLYNOMIAL>(&timeFrame[DataDecoder::CRC8_DATA_FIRST_BYTE], DataDecoder::CRC8_DATA_BYTES_NO, DataDecoder::CRC8_INIT_VALUE);
+
+  return timeFrame;
+}
+
+uint32_t SignalGenerator::getRandom() {
+  // xorshift32
+  _randomState ^= (_randomState << 13U);
+  _randomState ^= (_randomState >> 17U);
+  _randomState ^= (_randomState << 5U);
+  return _randomState;
+}
+
+void SignalGenerator::preparePulses(uint64_t frameNo) {
+  DataDecoder::TimeFrame frame{};
+
+  if (isTimeFrame(frameNo)) {
+    frame = encodeTimeFrame(getTimeData(frameNo));
+  } else {
+    // other frames share only the sync word
+    frame[0] = static_cast<uint8_t>(DataDecoder::SYNC_WORD >> 8U);
+    frame[1] = static_cast<uint8_t>(DataDecoder::SYNC_WORD & 0x00FF);
+    for (auto frameByteNo{2U}; frameByteNo < DataDecoder::TIME_FRAME_BYTES_NO; frameByteNo++) {
+      frame[frameByteNo] = static_cast<uint8_t>(getRandom());
+    }
+    if (frame[2] == DataDecoder::TIME_FRAME_START_BYTE) {
+      frame[2] ^= 0x01;
+    }
+  }
+
+  // phase changes when bit value changes (positive pulse for 0 -> 1, negative one for 1 -> 0), carrier is idle at bit value 1
+  bool bitValueIsOne{DataDecoder::FRAME_DATA_READ_START_PRECONDITION};
+  for (uint8_t bitNo{0U}; bitNo < FRAME_PULSES_NO; bitNo++) {
+    const auto nextBitValueIsOne{(bitNo < DataDecoder::TIME_FRAME_BITS_NO) ? static_cast<bool>(getFrameBits(frame, bitNo, 1U)) : true};
+    _pulses[bitNo] = static_cast<int8_t>((nextBitValueIsOne == bitValueIsOne) ? 0 : (nextBitValueIsOne ? 1 : -1));
+    bitValueIsOne = nextBitValueIsOne;
+  }
+
+  _pulsesFrameNo = frameNo;
+}
+
+void SignalGenerator::encodeRsParity(DataDecoder::TimeFrame& timeFrame) {
+  /* Codeword is systematic: data symbols (S0-SK0) are coefficients of x^6..x^14 and parity symbols (ECC0-ECC2) of x^0..x^5.
+     Parity is the reminder of data polynomial (shifted by x^6) division by the generator polynomial. */
+  std::array<uint8_t, DataDecoder::RS_PARITY_SYMBOLS_NO> parity{};
+
+  for (auto symbolNo{static_cast<int8_t>(DataDecoder::RS_DATA_SYMBOLS_NO - 1U)}; symbolNo >= 0; symbolNo--) {
+    const auto symbol{getFrameBits(timeFrame, static_cast<uint8_t>(DataDecoder::RS_FIRST_DATA_BIT_NO + (symbolNo * 4U)), 4U)};
+    const auto feedback{static_cast<uint8_t>(symbol ^ parity[DataDecoder::RS_PARITY_SYMBOLS_NO - 1U])};
+
+    for (auto coefficientNo{static_cast<uint8_t>(DataDecoder::RS_PARITY_SYMBOLS_NO - 1U)}; coefficientNo > 0U; coefficientNo--) {
+      parity[coefficientNo] = static_cast<uint8_t>(parity[coefficientNo - 1U] ^ gf16::mul(feedback, RS_GENERATOR[coefficientNo]));
+    }
+    parity[0] = gf16::mul(feedback, RS_GENERATOR[0]);
+  }
+
+  // ECC0 upper nibble is a coefficient of x^0
+  for (uint8_t parityNo{0U}; parityNo < DataDecoder::RS_PARITY_SYMBOLS_NO; parityNo++) {
+    setFrameBits(timeFrame, static_cast<uint8_t>(DataDecoder::RS_FIRST_PARITY_BIT_NO + (parityNo * 4U)), 4U, parity[parityNo]);
+  }
+}
+
+}  // namespace eczas
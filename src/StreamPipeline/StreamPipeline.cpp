@@ -0,0 +1,178 @@
+/**
+ * @file StreamPipeline.cpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <StreamPipeline/StreamPipeline.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+namespace eczas {
+
+StreamPipeline::StreamPipeline(const Config& config)
+  : _config(config),
+    _decoder(config.streamSamplesPerBit),
+    _samplesQueue(std::make_unique<SamplesQueue>()),
+    _eventsQueue(std::make_unique<EventsQueue>()) {
+  _decoder.setPhaseDiversity(config.phaseDiversity);
+}
+
+StreamPipeline::Result StreamPipeline::run(tools::SampleInput& input, const EventHandler& eventHandler) {
+  Result result{};
+
+  _readerDone.store(false);
+  _decoderDone.store(false);
+  _droppedSamplesNo = 0U;
+  _droppedEventsNo = 0U;
+
+  std::thread decoderThread{&StreamPipeline::decoderStage, this, std::ref(result)};
+  std::thread outputThread{&StreamPipeline::outputStage, this, std::cref(eventHandler)};
+
+  readerStage(input);
+
+  decoderThread.join();
+  outputThread.join();
+
+  result.droppedSamplesNo = _droppedSamplesNo;
+  result.droppedEventsNo = _droppedEventsNo;
+
+  return result;
+}
+
+DataDecoder::Statistics StreamPipeline::getDecoderStatistics() const {
+  return _decoder.getStatistics();
+}
+
+void StreamPipeline::readerStage(tools::SampleInput& input) {
+  for (auto block{input.getNextBlock()}; block.has_value(); block = input.getNextBlock()) {
+    // input blocks (i.e. whole memory mapped recording) are split into queue items
+    for (size_t blockStart{0U}; blockStart < block->samplesNo; blockStart += SAMPLES_BLOCK_SIZE) {
+      const auto samplesNo{((block->samplesNo - blockStart) < SAMPLES_BLOCK_SIZE) ? (block->samplesNo - blockStart) : SAMPLES_BLOCK_SIZE};
+
+      auto slot{_samplesQueue->getFreeSlot()};
+      for (uint32_t idleRoundsNo{0U}; (slot == nullptr) and (_config.samplesOverflowPolicy == OverflowPolicy::Wait);
+           slot = _samplesQueue->getFreeSlot()) {
+        waitForQueue(idleRoundsNo);
+      }
+
+      if (slot == nullptr) {
+        _droppedSamplesNo += samplesNo;
+        continue;
+      }
+
+      memcpy(slot->samples.data(), block->samples + blockStart, samplesNo * sizeof(int16_t));
+      slot->samplesNo = samplesNo;
+      _samplesQueue->push();
+    }
+  }
+
+  _readerDone.store(true, std::memory_order_release);
+}
+
+void StreamPipeline::decoderStage(Result& result) {
+  DecoderSink sink{*this};
+
+  uint32_t idleRoundsNo{0U};
+
+  while (true) {
+    auto block{_samplesQueue->getFront()};
+
+    if (block == nullptr) {
+      // reader is done only after its last push so queue has to be checked once more
+      if (_readerDone.load(std::memory_order_acquire) and _samplesQueue->isEmpty()) {
+        break;
+      }
+      waitForQueue(idleRoundsNo);
+      continue;
+    }
+    idleRoundsNo = 0U;
+
+    const auto blockResult{_decoder.processSamples(block->samples.data(), block->samplesNo, sink)};
+    _samplesQueue->pop();
+
+    if (blockResult.overrunsNo) {
+      auto event{getEventSlot()};
+      if (event) {
+        event->type = EventType::StreamBufferFull;
+        event->overrunsNo = blockResult.overrunsNo;
+        _eventsQueue->push();
+      }
+    }
+
+    result.samplesNo += blockResult.samplesNo;
+    result.overrunsNo += blockResult.overrunsNo;
+    result.timeFramesNo += blockResult.timeFramesNo;
+  }
+
+  _decoderDone.store(true, std::memory_order_release);
+}
+
+void StreamPipeline::outputStage(const EventHandler& eventHandler) {
+  Event idleEvent{};
+  idleEvent.type = EventType::OutputIdle;
+
+  uint32_t idleRoundsNo{0U};
+  auto eventsHandled{false};
+
+  while (true) {
+    auto event{_eventsQueue->getFront()};
+
+    if (event == nullptr) {
+      // idle is reported once after the queue got drained
+      if (eventsHandled and eventHandler) {
+        eventHandler(idleEvent);
+      }
+      eventsHandled = false;
+
+      if (_decoderDone.load(std::memory_order_acquire) and _eventsQueue->isEmpty()) {
+        break;
+      }
+      waitForQueue(idleRoundsNo);
+      continue;
+    }
+    idleRoundsNo = 0U;
+
+    if (eventHandler) {
+      eventHandler(*event);
+    }
+    _eventsQueue->pop();
+    eventsHandled = true;
+  }
+}
+
+StreamPipeline::Event* StreamPipeline::getEventSlot() {
+  auto slot{_eventsQueue->getFreeSlot()};
+  for (uint32_t idleRoundsNo{0U}; (slot == nullptr) and (_config.eventsOverflowPolicy == OverflowPolicy::Wait);
+       slot = _eventsQueue->getFreeSlot()) {
+    waitForQueue(idleRoundsNo);
+  }
+
+  if (slot == nullptr) {
+    _droppedEventsNo++;
+  }
+
+  return slot;
+}
+
+void StreamPipeline::waitForQueue(uint32_t& idleRoundsNo) {
+  static constexpr uint32_t YIELDING_ROUNDS_NO{64U};
+  static constexpr std::chrono::microseconds SLEEP_TIME{200};
+
+  // short waits give the CPU away only for a moment, long ones (i.e. slow input) don't keep it busy
+  if (idleRoundsNo < YIELDING_ROUNDS_NO) {
+    idleRoundsNo++;
+    std::this_thread::yield();
+  } else {
+    std::this_thread::sleep_for(SLEEP_TIME);
+  }
+}
+
+}  // namespace eczas
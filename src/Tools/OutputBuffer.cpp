@@ -0,0 +1,115 @@
+/**
+ * @file OutputBuffer.cpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <Tools/OutputBuffer.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+
+namespace tools {
+
+OutputBuffer::OutputBuffer(int fd) : _fd(fd) {
+}
+
+OutputBuffer::~OutputBuffer() {
+  flush();
+}
+
+void OutputBuffer::append(const void* data, size_t size) {
+  auto bytes{static_cast<const char*>(data)};
+
+  while (size != 0U) {
+    if (_bufferedBytesNo == BUFFER_SIZE) {
+      flush();
+    }
+
+    const auto freeBytesNo{BUFFER_SIZE - _bufferedBytesNo};
+    const auto chunkSize{(size < freeBytesNo) ? size : freeBytesNo};
+
+    memcpy(_buffer.data() + _bufferedBytesNo, bytes, chunkSize);
+    _bufferedBytesNo += chunkSize;
+    bytes += chunkSize;
+    size -= chunkSize;
+  }
+}
+
+void OutputBuffer::append(const char* text) {
+  append(text, strlen(text));
+}
+
+void OutputBuffer::append(char character) {
+  if (_bufferedBytesNo == BUFFER_SIZE) {
+    flush();
+  }
+
+  _buffer[_bufferedBytesNo++] = character;
+}
+
+void OutputBuffer::appendDecimal(uint64_t value, uint8_t minWidth, char pad) {
+  std::array<char, MAX_DECIMAL_DIGITS_NO> digits{};
+  uint8_t digitsNo{0U};
+
+  // digits are produced from the least significant one
+  do {
+    digits[MAX_DECIMAL_DIGITS_NO - 1U - digitsNo] = static_cast<char>('0' + (value % 10U));
+    value /= 10U;
+    digitsNo++;
+  } while (value != 0U);
+
+  for (auto padNo{digitsNo}; padNo < minWidth; padNo++) {
+    append(pad);
+  }
+
+  append(digits.data() + MAX_DECIMAL_DIGITS_NO - digitsNo, digitsNo);
+}
+
+void OutputBuffer::appendHex(uint8_t value) {
+  static constexpr char HEX_DIGITS[]{"0123456789ABCDEF"};
+
+  const char text[]{HEX_DIGITS[value >> 4U], HEX_DIGITS[value & 0x0F]};
+  append(text, sizeof(text));
+}
+
+void OutputBuffer::appendBinary(uint8_t value) {
+  std::array<char, 8U> text{};
+
+  for (auto& digit : text) {
+    digit = (value & 0x80) ? '1' : '0';
+    value = static_cast<uint8_t>(value << 1U);
+  }
+
+  append(text.data(), text.size());
+}
+
+bool OutputBuffer::flush() {
+  static constexpr bool NO_ERROR{false};
+  static constexpr bool AN_ERROR{true};
+
+  size_t writtenBytesNo{0U};
+
+  while ((writtenBytesNo < _bufferedBytesNo) and not _writeError) {
+    const auto result{write(_fd, _buffer.data() + writtenBytesNo, _bufferedBytesNo - writtenBytesNo)};
+
+    if (result > 0) {
+      writtenBytesNo += static_cast<size_t>(result);
+    } else if ((result == 0) or (errno != EINTR)) {
+      // no progress is reported as an error rather than retried forever
+      _writeError = true;
+    }
+  }
+
+  _bufferedBytesNo = 0U;
+
+  return (_writeError ? AN_ERROR : NO_ERROR);
+}
+
+}  // namespace tools
@@ -0,0 +1,406 @@
+/**
+ * @file RecordWriter.cpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <Tools/RecordWriter.hpp>
+
+#include <array>
+#include <cstring>
+#include <unistd.h>
+
+namespace tools {
+
+namespace {
+
+static constexpr uint32_t SECONDS_IN_HOUR{3600U};
+static constexpr uint32_t SECONDS_IN_DAY{86400U};
+
+static constexpr const char* WEEKDAY_NAMES[]{"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+static constexpr const char* MONTH_NAMES[]{"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+/// @brief Calendar time (UTC)
+struct CalendarTime {
+  uint32_t year;
+  uint8_t month;  // 1..12
+  uint8_t day;    // 1..31
+  uint8_t weekday;  // 0 - Sunday
+  uint8_t hour;
+  uint8_t minute;
+  uint8_t second;
+};
+
+/// Calendar date is calculated from days since 1970 directly (gmtime() is not needed and the result is not shared)
+CalendarTime getCalendarTime(uint64_t unixTimestamp) {
+  static constexpr uint32_t DAYS_FROM_YEAR_0_TO_1970{719468U};  // counted from 1st of March of the year 0
+  static constexpr uint32_t DAYS_IN_400_YEARS{146097U};
+  static constexpr uint8_t THURSDAY{4U};  // 1st of January 1970
+
+  const auto days{unixTimestamp / SECONDS_IN_DAY};
+  const auto secondOfDay{static_cast<uint32_t>(unixTimestamp % SECONDS_IN_DAY)};
+
+  // years start in March so the leap day is the last one of the year
+  const auto shiftedDays{days + DAYS_FROM_YEAR_0_TO_1970};
+  const auto era{shiftedDays / DAYS_IN_400_YEARS};
+  const auto dayOfEra{static_cast<uint32_t>(shiftedDays - (era * DAYS_IN_400_YEARS))};
+  const auto yearOfEra{(dayOfEra - (dayOfEra / 1460U) + (dayOfEra / 36524U) - (dayOfEra / 146096U)) / 365U};
+  const auto dayOfYear{dayOfEra - ((365U * yearOfEra) + (yearOfEra / 4U) - (yearOfEra / 100U))};
+  const auto shiftedMonth{((5U * dayOfYear) + 2U) / 153U};
+  const auto month{static_cast<uint8_t>((shiftedMonth < 10U) ? (shiftedMonth + 3U) : (shiftedMonth - 9U))};
+
+  CalendarTime time{};
+  time.year = static_cast<uint32_t>(yearOfEra + (era * 400U) + ((month <= 2U) ? 1U : 0U));
+  time.month = month;
+  time.day = static_cast<uint8_t>(dayOfYear - (((153U * shiftedMonth) + 2U) / 5U) + 1U);
+  time.weekday = static_cast<uint8_t>((days + THURSDAY) % 7U);
+  time.hour = static_cast<uint8_t>(secondOfDay / SECONDS_IN_HOUR);
+  time.minute = static_cast<uint8_t>((secondOfDay % SECONDS_IN_HOUR) / 60U);
+  time.second = static_cast<uint8_t>(secondOfDay % 60U);
+
+  return time;
+}
+
+const char* getJsonRecordTypeName(RecordWriter::RecordType type) {
+  switch (type) {
+    case RecordWriter::RecordType::RawTimeFrame:
+      return "raw_time_frame";
+    case RecordWriter::RecordType::RsProcessedTimeFrame:
+      return "rs_processed_time_frame";
+    case RecordWriter::RecordType::CrcProcessedTimeFrame:
+      return "crc_processed_time_frame";
+    case RecordWriter::RecordType::TimeData:
+      return "time_data";
+    case RecordWriter::RecordType::TimeFrameProcessingError:
+      return "time_frame_processing_error";
+    case RecordWriter::RecordType::StreamBufferFull:
+      return "stream_buffer_full";
+    case RecordWriter::RecordType::SamplesDropped:
+      return "samples_dropped";
+    case RecordWriter::RecordType::EventsDropped:
+      return "events_dropped";
+    default:
+      return "processed_samples";
+  }
+}
+
+void writeUint32(uint8_t* data, uint32_t value) {
+  data[0] = static_cast<uint8_t>(value);
+  data[1] = static_cast<uint8_t>(value >> 8U);
+  data[2] = static_cast<uint8_t>(value >> 16U);
+  data[3] = static_cast<uint8_t>(value >> 24U);
+}
+
+void writeUint64(uint8_t* data, uint64_t value) {
+  writeUint32(&data[0], static_cast<uint32_t>(value));
+  writeUint32(&data[4], static_cast<uint32_t>(value >> 32U));
+}
+
+}  // namespace
+
+std::optional<OutputFormat> parseOutputFormat(const char* name) {
+  if (strcmp(name, "text") == 0) {
+    return OutputFormat::Text;
+  }
+  if (strcmp(name, "jsonl") == 0) {
+    return OutputFormat::JsonLines;
+  }
+  if (strcmp(name, "binary") == 0) {
+    return OutputFormat::Binary;
+  }
+
+  return std::nullopt;
+}
+
+RecordWriter::RecordWriter(OutputFormat format, int fd, bool detailed) : _format(format), _detailed(detailed), _output(fd) {
+}
+
+void RecordWriter::writeTimeFrame(RecordType type, const eczas::DataDecoder::TimeFrame& timeFrame, uint64_t sampleNo) {
+  switch (_format) {
+    case OutputFormat::JsonLines:
+      writeJsonRecordStart(type);
+      _output.append(",\"sample\":");
+      _output.appendDecimal(sampleNo);
+      _output.append(",\"frame\":\"");
+      for (auto byte : timeFrame) {
+        _output.appendHex(byte);
+      }
+      _output.append("\"}\n");
+      break;
+
+    case OutputFormat::Binary:
+      writeBinaryRecord(type, &timeFrame, nullptr, sampleNo, 0U, 0U);
+      break;
+
+    default:
+      if (type == RecordType::RawTimeFrame) {
+        _output.append("\n┌ Raw time frame (at sample ");
+      } else if (type == RecordType::RsProcessedTimeFrame) {
+        _output.append("\n├ RS processed time frame (at sample ");
+      } else {
+        _output.append("\n└ CRC processed time frame (at sample ");
+      }
+      _output.appendDecimal(sampleNo);
+      if (type == RecordType::RawTimeFrame) {
+        _output.append("):           ");
+      } else if (type == RecordType::RsProcessedTimeFrame) {
+        _output.append("):  ");
+      } else {
+        _output.append("): ");
+      }
+
+      for (auto byte : timeFrame) {
+        _output.appendBinary(byte);
+        _output.append('(');
+        _output.appendHex(byte);
+        _output.append(") ");
+      }
+      break;
+  }
+}
+
+void RecordWriter::writeTimeData(const eczas::DataDecoder::TimeData& timeData, uint64_t sampleNo) {
+  const auto offsetInHours{static_cast<uint8_t>(timeData.offset)};
+
+  switch (_format) {
+    case OutputFormat::JsonLines:
+      writeJsonRecordStart(RecordType::TimeData);
+      _output.append(",\"sample\":");
+      _output.appendDecimal(sampleNo);
+      _output.append(",\"utc\":\"");
+      writeIsoTime(timeData.utcUnixTimestamp);
+      _output.append("\",\"utc_unix\":");
+      _output.appendDecimal(timeData.utcUnixTimestamp);
+      _output.append(",\"utc_2000\":");
+      _output.appendDecimal(timeData.utcTimestamp);
+      _output.append(",\"offset_hours\":");
+      _output.appendDecimal(offsetInHours);
+      _output.append(",\"time_zone_change\":");
+      _output.append(timeData.timeZoneChangeAnnouncement ? "true" : "false");
+      _output.append(",\"leap_second\":\"");
+      _output.append(timeData.leapSecondAnnounced ? (timeData.leapSecondPositive ? "positive" : "negative") : "none");
+      _output.append("\",\"transmitter\":\"");
+      switch (timeData.transmitterState) {
+        case eczas::DataDecoder::TransmitterState::NormalOperation:
+          _output.append("ok");
+          break;
+        case eczas::DataDecoder::TransmitterState::PlannedMaintenance1Day:
+          _output.append("maintenance_1_day");
+          break;
+        case eczas::DataDecoder::TransmitterState::PlannedMaintenance1Week:
+          _output.append("maintenance_1_week");
+          break;
+        case eczas::DataDecoder::TransmitterState::PlannedMaintenanceOver1Week:
+          _output.append("maintenance_over_1_week");
+          break;
+        default:
+          _output.append("unknown");
+          break;
+      }
+      _output.append("\"}\n");
+      break;
+
+    case OutputFormat::Binary:
+      writeBinaryRecord(RecordType::TimeData, nullptr, &timeData, sampleNo, 0U, 0U);
+      break;
+
+    default:
+      if (_detailed) {
+        _output.append("\n┌ Time message (from time frame at sample ");
+        _output.appendDecimal(sampleNo);
+        _output.append(")\n");
+      } else {
+        _output.append("\n┌ Time message\n");
+      }
+
+      _output.append("├ UTC time          : ");
+      writeTextTime(timeData.utcUnixTimestamp);
+      _output.append("├ local time (UTC+");
+      _output.appendDecimal(offsetInHours);
+      _output.append("): ");
+      writeTextTime(static_cast<uint64_t>(timeData.utcUnixTimestamp) + (offsetInHours * SECONDS_IN_HOUR));
+      _output.append("├ seconds since year 2000: ");
+      _output.appendDecimal(timeData.utcTimestamp);
+      _output.append("\n├ seconds since year 1970: ");
+      _output.appendDecimal(timeData.utcUnixTimestamp);
+      _output.append('\n');
+
+      if (timeData.timeZoneChangeAnnouncement) {
+        _output.append("├ time zone offset change announced\n");
+      } else {
+        _output.append("├ no time zone offset change announced\n");
+      }
+
+      if (timeData.leapSecondAnnounced) {
+        if (timeData.leapSecondPositive) {
+          _output.append("├ positive leap second announced\n");
+        } else {
+          _output.append("├ negative leap second announced\n");
+        }
+      } else {
+        _output.append("├ no leap second announced\n");
+      }
+
+      switch (timeData.transmitterState) {
+        case eczas::DataDecoder::TransmitterState::PlannedMaintenance1Day:
+          _output.append("└ planned transmitter maintenance for 1 day\n");
+          break;
+        case eczas::DataDecoder::TransmitterState::PlannedMaintenance1Week:
+          _output.append("└ planned transmitter maintenance for 1 week\n");
+          break;
+        case eczas::DataDecoder::TransmitterState::PlannedMaintenanceOver1Week:
+          _output.append("└ planned transmitter maintenance for over 1 week\n");
+          break;
+        default:
+          _output.append("└ transmitter working OK\n");
+          break;
+      }
+      break;
+  }
+}
+
+void RecordWriter::writeTimeFrameProcessingError(eczas::DataDecoder::TimeFrameProcessingError error) {
+  const auto rsError{error == eczas::DataDecoder::TimeFrameProcessingError::RsCorrectionFailed};
+
+  switch (_format) {
+    case OutputFormat::JsonLines:
+      writeJsonRecordStart(RecordType::TimeFrameProcessingError);
+      _output.append(rsError ? ",\"error\":\"rs_correction_failed\"}\n" : ",\"error\":\"crc_correction_failed\"}\n");
+      break;
+
+    case OutputFormat::Binary:
+      writeBinaryRecord(RecordType::TimeFrameProcessingError, nullptr, nullptr, 0U, static_cast<uint8_t>(error), 0U);
+      break;
+
+    default:
+      _output.append(rsError ? "\n└ Error: Time data erros not recoverable using Reed-Solomon FEC" : "\n└ Error: CRC correction failed");
+      break;
+  }
+}
+
+void RecordWriter::writeCounter(RecordType type, uint64_t value) {
+  switch (_format) {
+    case OutputFormat::JsonLines:
+      writeJsonRecordStart(type);
+      _output.append(",\"count\":");
+      _output.appendDecimal(value);
+      _output.append("}\n");
+      break;
+
+    case OutputFormat::Binary:
+      writeBinaryRecord(type, nullptr, nullptr, 0U, 0U, value);
+      break;
+
+    default:
+      if (type == RecordType::StreamBufferFull) {
+        _output.append("\nE: Stream buffer full (");
+        _output.appendDecimal(value);
+        _output.append(" times)");
+      } else if (type == RecordType::SamplesDropped) {
+        _output.append("\nE: Samples dropped (");
+        _output.appendDecimal(value);
+        _output.append(")");
+      } else if (type == RecordType::EventsDropped) {
+        _output.append("\nE: Decoding events dropped (");
+        _output.appendDecimal(value);
+        _output.append(")");
+      } else {
+        _output.append("\nProcessed ");
+        _output.appendDecimal(value);
+        _output.append(" samples.\n");
+      }
+      break;
+  }
+}
+
+void RecordWriter::writeMessage(const char* text) {
+  if (_format == OutputFormat::Text) {
+    _output.append(text);
+  } else {
+    // stderr is not buffered so there is nothing to synchronize with
+    const auto result{write(STDERR_FILENO, text, strlen(text))};
+    (void)result;
+  }
+}
+
+bool RecordWriter::flush() {
+  return _output.flush();
+}
+
+void RecordWriter::writeTextTime(uint64_t unixTimestamp) {
+  // same as asctime(): "Www Mmm dd hh:mm:ss yyyy\n"
+  const auto time{getCalendarTime(unixTimestamp)};
+
+  _output.append(WEEKDAY_NAMES[time.weekday]);
+  _output.append(' ');
+  _output.append(MONTH_NAMES[time.month - 1U]);
+  _output.append(' ');
+  _output.appendDecimal(time.day, 2U, ' ');
+  _output.append(' ');
+  _output.appendDecimal(time.hour, 2U);
+  _output.append(':');
+  _output.appendDecimal(time.minute, 2U);
+  _output.append(':');
+  _output.appendDecimal(time.second, 2U);
+  _output.append(' ');
+  _output.appendDecimal(time.year);
+  _output.append('\n');
+}
+
+void RecordWriter::writeIsoTime(uint64_t unixTimestamp) {
+  // ISO 8601: "yyyy-mm-ddThh:mm:ssZ"
+  const auto time{getCalendarTime(unixTimestamp)};
+
+  _output.appendDecimal(time.year, 4U);
+  _output.append('-');
+  _output.appendDecimal(time.month, 2U);
+  _output.append('-');
+  _output.appendDecimal(time.day, 2U);
+  _output.append('T');
+  _output.appendDecimal(time.hour, 2U);
+  _output.append(':');
+  _output.appendDecimal(time.minute, 2U);
+  _output.append(':');
+  _output.appendDecimal(time.second, 2U);
+  _output.append('Z');
+}
+
+void RecordWriter::writeJsonRecordStart(RecordType type) {
+  _output.append("{\"type\":\"");
+  _output.append(getJsonRecordTypeName(type));
+  _output.append('"');
+}
+
+void RecordWriter::writeBinaryRecord(RecordType type, const eczas::DataDecoder::TimeFrame* timeFrame, const eczas::DataDecoder::TimeData* timeData,
+                                     uint64_t sampleNo, uint8_t error, uint64_t value) {
+  static_assert(eczas::DataDecoder::TIME_FRAME_BYTES_NO <= 12U, "Time frame doesn't fit binary record");
+
+  std::array<uint8_t, BINARY_RECORD_SIZE> record{};
+
+  record[0] = static_cast<uint8_t>(type);
+  record[1] = error;
+  writeUint64(&record[8], sampleNo);
+
+  if (timeData) {
+    record[2] = static_cast<uint8_t>(timeData->offset);
+    record[3] = static_cast<uint8_t>((timeData->timeZoneChangeAnnouncement ? 0x01 : 0x00) | (timeData->leapSecondAnnounced ? 0x02 : 0x00) |
+                                     (timeData->leapSecondPositive ? 0x04 : 0x00));
+    record[4] = static_cast<uint8_t>(timeData->transmitterState);
+    writeUint32(&record[16], timeData->utcUnixTimestamp);
+  }
+
+  if (timeFrame) {
+    memcpy(&record[20], timeFrame->data(), timeFrame->size());
+  } else {
+    writeUint64(&record[20], value);
+  }
+
+  _output.append(record.data(), record.size());
+}
+
+}  // namespace tools
@@ -0,0 +1,178 @@
+/**
+ * @file SampleFormat.cpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <Tools/SampleFormat.hpp>
+
+#include <cstring>
+
+namespace tools {
+
+namespace {
+
+/// WAV format tags
+static constexpr uint16_t WAV_FORMAT_PCM{0x0001};
+static constexpr uint16_t WAV_FORMAT_IEEE_FLOAT{0x0003};
+static constexpr uint16_t WAV_FORMAT_EXTENSIBLE{0xFFFE};
+
+/// Float samples full scale
+static constexpr float FLOAT_SCALE{32767.0F};
+static constexpr float FLOAT_MAX{32767.0F};
+static constexpr float FLOAT_MIN{-32768.0F};
+
+uint16_t readUint16(const uint8_t* data) {
+  return static_cast<uint16_t>(data[0] | (data[1] << 8U));
+}
+
+uint32_t readUint32(const uint8_t* data) {
+  return (static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8U) | (static_cast<uint32_t>(data[2]) << 16U) | (static_cast<uint32_t>(data[3]) << 24U));
+}
+
+/* Conversion loops are kept trivial (no branches, fixed stride) to be auto-vectorized.
+   Format is selected once per block so there is no per sample dispatch.
+   Release build (-O2) vectorizes only loops of known trip count so a cheap cost model is requested explicitly
+   and, on x86, AVX2 version is built next to the baseline one (selected at runtime). */
+#if defined(__x86_64__) || defined(__i386__)
+#define CONVERSION_LOOP __attribute__((optimize("tree-vectorize", "vect-cost-model=cheap"), target_clones("avx2", "default")))
+#else
+#define CONVERSION_LOOP __attribute__((optimize("tree-vectorize", "vect-cost-model=cheap")))
+#endif
+
+CONVERSION_LOOP void convertInt32(const uint8_t* __restrict input, size_t samplesNo, int16_t* __restrict output) {
+  for (size_t sampleNo{0U}; sampleNo < samplesNo; sampleNo++) {
+    int32_t sample;
+    memcpy(&sample, input + (sampleNo * sizeof(int32_t)), sizeof(int32_t));
+    output[sampleNo] = static_cast<int16_t>(sample >> 16U);
+  }
+}
+
+inline int16_t scaleFloat(float sample) {
+  auto scaled{sample * FLOAT_SCALE};
+  // NaN fails both saturation comparisons (and its conversion to integer is undefined) so it's taken as silence
+  scaled = (scaled == scaled) ? scaled : 0.0F;
+  scaled = (scaled > FLOAT_MAX) ? FLOAT_MAX : scaled;
+  scaled = (scaled < FLOAT_MIN) ? FLOAT_MIN : scaled;
+  return static_cast<int16_t>(scaled);
+}
+
+CONVERSION_LOOP void convertFloat32(const uint8_t* __restrict input, size_t samplesNo, size_t stride, int16_t* __restrict output) {
+  for (size_t sampleNo{0U}; sampleNo < samplesNo; sampleNo++) {
+    float sample;
+    memcpy(&sample, input + (sampleNo * stride), sizeof(float));
+    output[sampleNo] = scaleFloat(sample);
+  }
+}
+
+}  // namespace
+
+std::optional<SampleFormat> parseSampleFormat(const char* name) {
+  if (strcmp(name, "int16") == 0) {
+    return SampleFormat::Int16;
+  }
+  if (strcmp(name, "int32") == 0) {
+    return SampleFormat::Int32;
+  }
+  if (strcmp(name, "float32") == 0) {
+    return SampleFormat::Float32;
+  }
+  if (strcmp(name, "cf32") == 0) {
+    return SampleFormat::ComplexFloat32;
+  }
+
+  return {};
+}
+
+WavHeaderStatus parseWavHeader(const uint8_t* data, size_t dataSize, WavDataInfo& info) {
+  static constexpr size_t RIFF_HEADER_SIZE{12U};
+  static constexpr size_t CHUNK_HEADER_SIZE{8U};
+  static constexpr size_t FMT_CHUNK_MIN_SIZE{16U};
+  static constexpr size_t FMT_EXTENSIBLE_SUBFORMAT_OFFSET{24U};
+
+  if (dataSize < RIFF_HEADER_SIZE) {
+    return ((dataSize < 4U) or (memcmp(data, "RIFF", 4U) == 0)) ? WavHeaderStatus::Incomplete : WavHeaderStatus::NotWav;
+  }
+
+  if ((memcmp(data, "RIFF", 4U) != 0) or (memcmp(data + 8U, "WAVE", 4U) != 0)) {
+    return WavHeaderStatus::NotWav;
+  }
+
+  std::optional<SampleFormat> format{};
+  size_t chunkOffset{RIFF_HEADER_SIZE};
+
+  // walk through the chunks until samples data is found ("fmt " chunk is required to precede "data")
+  while ((chunkOffset + CHUNK_HEADER_SIZE) <= dataSize) {
+    const auto* chunk{data + chunkOffset};
+    const auto chunkSize{static_cast<size_t>(readUint32(chunk + 4U))};
+    const auto* chunkData{chunk + CHUNK_HEADER_SIZE};
+
+    if (memcmp(chunk, "fmt ", 4U) == 0) {
+      if ((chunkOffset + CHUNK_HEADER_SIZE + chunkSize) > dataSize) {
+        return WavHeaderStatus::Incomplete;
+      }
+      if (chunkSize < FMT_CHUNK_MIN_SIZE) {
+        return WavHeaderStatus::NotSupported;
+      }
+
+      auto formatTag{readUint16(chunkData)};
+      const auto channelsNo{readUint16(chunkData + 2U)};
+      const auto bitsPerSample{readUint16(chunkData + 14U)};
+
+      // extensible format keeps actual format tag at the beginning of the sub-format GUID
+      if ((formatTag == WAV_FORMAT_EXTENSIBLE) and (chunkSize >= (FMT_EXTENSIBLE_SUBFORMAT_OFFSET + 2U))) {
+        formatTag = readUint16(chunkData + FMT_EXTENSIBLE_SUBFORMAT_OFFSET);
+      }
+
+      if ((formatTag == WAV_FORMAT_PCM) and (channelsNo == 1U) and (bitsPerSample == 16U)) {
+        format = SampleFormat::Int16;
+      } else if ((formatTag == WAV_FORMAT_PCM) and (channelsNo == 1U) and (bitsPerSample == 32U)) {
+        format = SampleFormat::Int32;
+      } else if ((formatTag == WAV_FORMAT_IEEE_FLOAT) and (channelsNo == 1U) and (bitsPerSample == 32U)) {
+        format = SampleFormat::Float32;
+      } else if ((formatTag == WAV_FORMAT_IEEE_FLOAT) and (channelsNo == 2U) and (bitsPerSample == 32U)) {
+        format = SampleFormat::ComplexFloat32;
+      } else {
+        return WavHeaderStatus::NotSupported;
+      }
+    } else if (memcmp(chunk, "data", 4U) == 0) {
+      if (not format.has_value()) {
+        return WavHeaderStatus::NotSupported;
+      }
+
+      info.format = format.value();
+      info.dataOffset = chunkOffset + CHUNK_HEADER_SIZE;
+      info.dataSize = chunkSize;
+      return WavHeaderStatus::Ok;
+    }
+
+    // chunks are word aligned
+    chunkOffset += CHUNK_HEADER_SIZE + chunkSize + (chunkSize & 0x01);
+  }
+
+  return WavHeaderStatus::Incomplete;
+}
+
+void convertSamples(SampleFormat format, const uint8_t* input, size_t samplesNo, int16_t* output) {
+  switch (format) {
+    case SampleFormat::Int32:
+      convertInt32(input, samplesNo, output);
+      break;
+    case SampleFormat::Float32:
+      convertFloat32(input, samplesNo, sizeof(float), output);
+      break;
+    case SampleFormat::ComplexFloat32:
+      convertFloat32(input, samplesNo, 2U * sizeof(float), output);
+      break;
+    default:
+      memcpy(output, input, samplesNo * sizeof(int16_t));
+      break;
+  }
+}
+
+}  // namespace tools
@@ -0,0 +1,238 @@
+/**
+ * @file SampleInput.cpp
+ * @author Grzegorz Kaczmarek SP6HFE
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <Tools/SampleInput.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace tools {
+
+SampleInput::~SampleInput() {
+  close();
+}
+
+bool SampleInput::openFile(const char* path, SampleFormat rawFormat) {
+  const auto fd{::open(path, O_RDONLY)};
+  if (fd < 0) {
+    return true;
+  }
+
+  return open(fd, true, rawFormat);
+}
+
+bool SampleInput::openStdin(SampleFormat rawFormat) {
+  return open(STDIN_FILENO, false, rawFormat);
+}
+
+SampleFormat SampleInput::getSampleFormat() const {
+  return _format;
+}
+
+bool SampleInput::isMapped() const {
+  return (_mapping != nullptr);
+}
+
+std::optional<SampleInput::SampleBlock> SampleInput::getAllSamples() {
+  if (not isMapped()) {
+    return {};
+  }
+
+  const auto samplesNo{_mappedDataSize / getSampleSize(_format)};
+
+  // aligned 16 bit samples are used in place
+  if ((_format == SampleFormat::Int16) and ((reinterpret_cast<uintptr_t>(_mappedData) % alignof(int16_t)) == 0U)) {
+    return SampleBlock{reinterpret_cast<const int16_t*>(_mappedData), samplesNo};
+  }
+
+  if (_convertedSamples.size() != samplesNo) {
+    _convertedSamples.resize(samplesNo);
+    convertSamples(_format, _mappedData, samplesNo, _convertedSamples.data());
+  }
+
+  return SampleBlock{_convertedSamples.data(), samplesNo};
+}
+
+std::optional<SampleInput::SampleBlock> SampleInput::getNextBlock() {
+  const auto sampleSize{getSampleSize(_format)};
+
+  if (isMapped()) {
+    const auto samplesNo{(_mappedDataSize - _mappedDataConsumedSize) / sampleSize};
+    if (samplesNo == 0U) {
+      return {};
+    }
+
+    // aligned 16 bit samples are returned in place at once, other are converted block by block
+    if ((_format == SampleFormat::Int16) and ((reinterpret_cast<uintptr_t>(_mappedData) % alignof(int16_t)) == 0U)) {
+      _mappedDataConsumedSize = _mappedDataSize;
+      return SampleBlock{reinterpret_cast<const int16_t*>(_mappedData), samplesNo};
+    }
+
+    const auto blockSamplesNo{(samplesNo < _buffer.size()) ? samplesNo : _buffer.size()};
+    convertSamples(_format, _mappedData + _mappedDataConsumedSize, blockSamplesNo, _buffer.data());
+    _mappedDataConsumedSize += blockSamplesNo * sampleSize;
+
+    return SampleBlock{_buffer.data(), blockSamplesNo};
+  }
+
+  // read until at least one complete sample is available (pipe reads may return any amount of bytes)
+  while (_rawBufferedBytesNo < sampleSize) {
+    if (readStream()) {
+      // end of input (incomplete sample is dropped)
+      return {};
+    }
+  }
+
+  auto samplesNo{_rawBufferedBytesNo / sampleSize};
+  if (samplesNo > _buffer.size()) {
+    samplesNo = _buffer.size();
+  }
+
+  convertSamples(_format, _rawBuffer.data(), samplesNo, _buffer.data());
+
+  // keep incomplete sample for the next block
+  const auto consumedBytesNo{samplesNo * sampleSize};
+  _rawBufferedBytesNo -= consumedBytesNo;
+  memmove(_rawBuffer.data(), _rawBuffer.data() + consumedBytesNo, _rawBufferedBytesNo);
+
+  return SampleBlock{_buffer.data(), samplesNo};
+}
+
+bool SampleInput::open(int fd, bool ownFd, SampleFormat rawFormat) {
+  close();
+
+  _fd = fd;
+  _ownFd = ownFd;
+
+  struct stat fileStat {};
+  if (fstat(fd, &fileStat) != 0) {
+    close();
+    return true;
+  }
+
+  // regular non empty files are mapped, everything else is read as a stream
+  if (S_ISREG(fileStat.st_mode) and (fileStat.st_size > 0)) {
+    const auto fileSize{static_cast<size_t>(fileStat.st_size)};
+    auto* mapping{mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0)};
+
+    if (mapping != MAP_FAILED) {
+      madvise(mapping, fileSize, MADV_SEQUENTIAL);
+      _mapping = mapping;
+      _mappingSize = fileSize;
+    }
+  }
+
+  const auto openError{isMapped() ? openMapped(rawFormat) : openStream(rawFormat)};
+  if (openError) {
+    close();
+  }
+
+  return openError;
+}
+
+bool SampleInput::openMapped(SampleFormat rawFormat) {
+  const auto* data{static_cast<const uint8_t*>(_mapping)};
+  WavDataInfo wavInfo{};
+
+  switch (parseWavHeader(data, _mappingSize, wavInfo)) {
+    case WavHeaderStatus::Ok: {
+      const auto availableDataSize{_mappingSize - wavInfo.dataOffset};
+      _format = wavInfo.format;
+      _mappedData = data + wavInfo.dataOffset;
+      // data size may be left not updated by the recording software (i.e. when it was stopped abruptly)
+      _mappedDataSize = ((wavInfo.dataSize == 0U) or (wavInfo.dataSize > availableDataSize)) ? availableDataSize : wavInfo.dataSize;
+      return false;
+    }
+    case WavHeaderStatus::NotWav:
+      _format = rawFormat;
+      _mappedData = data;
+      _mappedDataSize = _mappingSize;
+      return false;
+    default:
+      return true;
+  }
+}
+
+bool SampleInput::openStream(SampleFormat rawFormat) {
+  WavDataInfo wavInfo{};
+
+  // stream may start with WAV header so it is buffered until it's clear if there is one
+  for (;;) {
+    switch (parseWavHeader(_rawBuffer.data(), _rawBufferedBytesNo, wavInfo)) {
+      case WavHeaderStatus::Ok:
+        // data length is not respected as streamed WAV usually has it not set
+        _format = wavInfo.format;
+        _rawBufferedBytesNo -= wavInfo.dataOffset;
+        memmove(_rawBuffer.data(), _rawBuffer.data() + wavInfo.dataOffset, _rawBufferedBytesNo);
+        return false;
+      case WavHeaderStatus::NotWav:
+        _format = rawFormat;
+        return false;
+      case WavHeaderStatus::Incomplete:
+        if (_rawBufferedBytesNo == _rawBuffer.size()) {
+          return true;
+        }
+        if (readStream()) {
+          // stream too short to have any samples after WAV header
+          _format = rawFormat;
+          return false;
+        }
+        break;
+      default:
+        return true;
+    }
+  }
+}
+
+bool SampleInput::readStream() {
+  for (;;) {
+    const auto bytesRead{::read(_fd, _rawBuffer.data() + _rawBufferedBytesNo, _rawBuffer.size() - _rawBufferedBytesNo)};
+
+    if (bytesRead > 0) {
+      _rawBufferedBytesNo += static_cast<size_t>(bytesRead);
+      return false;
+    }
+
+    if ((bytesRead < 0) and (errno == EINTR)) {
+      continue;
+    }
+
+    // end of the stream or read error
+    return true;
+  }
+}
+
+void SampleInput::close() {
+  if (_mapping) {
+    munmap(_mapping, _mappingSize);
+  }
+
+  if (_ownFd and (_fd >= 0)) {
+    ::close(_fd);
+  }
+
+  _fd = -1;
+  _ownFd = false;
+  _format = SampleFormat::Int16;
+  _mapping = nullptr;
+  _mappingSize = 0U;
+  _mappedData = nullptr;
+  _mappedDataSize = 0U;
+  _mappedDataConsumedSize = 0U;
+  _convertedSamples.clear();
+  _rawBufferedBytesNo = 0U;
+}
+
+}  // namespace tools
@@ -9,143 +9,322 @@
  *
  */
 
+#include <ChunkedDecoder/ChunkedDecoder.hpp>
 #include <DataDecoder/DataDecoder.hpp>
-#include <Tools/Helpers.hpp>
+#include <DataDecoder/Tracing.hpp>
+#include <StreamPipeline/StreamPipeline.hpp>
+#include <Tools/RecordWriter.hpp>
+#include <Tools/SampleFormat.hpp>
+#include <Tools/SampleInput.hpp>
 
-#include <iostream>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <mutex>
 #include <optional>
+#include <signal.h>
 #include <stdio.h>
-#include <time.h>
+#include <thread>
+#include <unistd.h>
 
 using namespace std;
 
 static constexpr uint8_t RAW_DATA_SAMPLES_PER_BIT{10U};
 
-union ByteTranslator {
-  char bytes[2U];
-  uint16_t uint16;
-};
+/// Each worker gets at least few chunks to balance the load while overlaps stay a small fraction of the chunk
+static constexpr size_t CHUNKS_PER_THREAD{4U};
+static constexpr size_t MIN_CHUNK_OVERLAPS_NO{64U};
+
+/// Time frames are reported (and time messages carry sample numbers) in debug build only
+#ifdef DEBUG
+static constexpr bool DETAILED_OUTPUT{true};
+#else
+static constexpr bool DETAILED_OUTPUT{false};
+#endif
 
-void printFrameContent(const eczas::DataDecoder::TimeFrame& frame) {
-  for (auto byte : frame) {
-    tools::Helpers::printBinaryValue(byte);
-    printf("(%02X) ", byte);
+/// Decoder statistics are printed to stderr as JSON line so they don't mix with decoding results
+void printStatistics(const eczas::DataDecoder::Statistics& statistics) {
+  std::array<char, 1024U> text{};
+  auto length{snprintf(text.data(), text.size(),
+                       "{\"type\":\"statistics\",\"samples\":%llu,\"overruns\":%llu,\"sync_word_detections\":%llu,"
+                       "\"static_fields_rejections\":%llu,\"rs_corrections\":[",
+                       static_cast<unsigned long long>(statistics.samplesNo), static_cast<unsigned long long>(statistics.overrunsNo),
+                       static_cast<unsigned long long>(statistics.syncWordDetectionsNo), static_cast<unsigned long long>(statistics.staticFieldsRejectionsNo))};
+
+  for (size_t fixedSymbolsNo{0U}; fixedSymbolsNo < statistics.rsCorrectionsNo.size(); fixedSymbolsNo++) {
+    length += snprintf(text.data() + length, text.size() - length, (fixedSymbolsNo == 0U) ? "%llu" : ",%llu",
+                       static_cast<unsigned long long>(statistics.rsCorrectionsNo[fixedSymbolsNo]));
   }
+
+  snprintf(text.data() + length, text.size() - length,
+           "],\"soft_decision_recoveries\":%llu,\"rs_failures\":%llu,\"sk1_repairs\":%llu,\"crc_failures\":%llu,\"time_frames\":%llu,"
+           "\"backlog_samples\":%u}\n",
+           static_cast<unsigned long long>(statistics.softDecisionRecoveriesNo), static_cast<unsigned long long>(statistics.rsFailuresNo),
+           static_cast<unsigned long long>(statistics.sk1RepairsNo), static_cast<unsigned long long>(statistics.crcFailuresNo),
+           static_cast<unsigned long long>(statistics.timeFramesNo), statistics.backlogSamplesNo);
+
+  fputs(text.data(), stderr);
 }
 
-int main() {
-#ifdef DEBUG
-  auto handleRawTimeFrameData{[](std::pair<const eczas::DataDecoder::TimeFrame&, uint32_t> frameDetails) {
-    printf("\n┌ Raw time frame (at sample %d):           ", frameDetails.second);
-    printFrameContent(frameDetails.first);
-  }};
-
-  auto handleReedSolomonProcessedTimeFrameData{[](std::pair<const eczas::DataDecoder::TimeFrame&, uint32_t> codeWordDetails) {
-    printf("\n├ RS processed time frame (at sample %d):  ", codeWordDetails.second);
-    printFrameContent(codeWordDetails.first);
-  }};
-
-  auto handleCrcProcessedTimeFrameData{[](std::pair<const eczas::DataDecoder::TimeFrame&, uint32_t> frameDetails) {
-    printf("\n└ CRC processed time frame (at sample %d): ", frameDetails.second);
-    printFrameContent(frameDetails.first);
-  }};
-#endif
+/// Prints statistics periodically from its own thread (stops on destruction)
+class StatisticsMonitor {
+public:
+  StatisticsMonitor(uint32_t periodSeconds, std::function<eczas::DataDecoder::Statistics()> statisticsGetter)
+    : _periodSeconds(periodSeconds),
+      _statisticsGetter(std::move(statisticsGetter)) {
+    if (_periodSeconds) {
+      _thread = std::thread{&StatisticsMonitor::run, this};
+    }
+  }
 
-  auto handleTimeFrameProcessingError{
-    [](eczas::DataDecoder::TimeFrameProcessingError error) {
-      switch (error) {
-        case eczas::DataDecoder::TimeFrameProcessingError::RsCorrectionFailed:
-          printf("\n└ Error: Time data erros not recoverable using Reed-Solomon FEC");
-          break;
-        case eczas::DataDecoder::TimeFrameProcessingError::CrcCorrectionFailed:
-          printf("\n└ Error: CRC correction failed");
-          break;
-        default:
-          break;
+  ~StatisticsMonitor() {
+    if (_thread.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _stopping = true;
       }
-    }};
+      _stop.notify_one();
+      _thread.join();
 
-  auto handleTimeData{[](std::pair<const eczas::DataDecoder::TimeData&, uint32_t> timeDetails) {
-    static constexpr uint32_t secondsInHour{3600U};
+      // final snapshot covers all the samples
+      printStatistics(_statisticsGetter());
+    }
+  }
 
-    auto localTimeOffsetInHours{static_cast<uint8_t>(timeDetails.first.offset)};
-    time_t utcTime{timeDetails.first.utcUnixTimestamp};
-    time_t localUtcTime{timeDetails.first.utcUnixTimestamp + (localTimeOffsetInHours * secondsInHour)};
+private:
+  const uint32_t _periodSeconds;
 
-#ifdef DEBUG
-    printf("\n┌ Time message (from time frame at sample %d)\n", timeDetails.second);
-#else
-    printf("\n┌ Time message\n");
-#endif
+  std::function<eczas::DataDecoder::Statistics()> _statisticsGetter;
 
-    printf("├ UTC time          : %s", asctime(gmtime(&utcTime)));
-    printf("├ local time (UTC+%d): %s", localTimeOffsetInHours, asctime(gmtime(&localUtcTime)));
-    printf("├ seconds since year 2000: %d\n", timeDetails.first.utcTimestamp);
-    printf("├ seconds since year 1970: %d\n", timeDetails.first.utcUnixTimestamp);
+  std::mutex _mutex{};
 
-    if (timeDetails.first.timeZoneChangeAnnouncement) {
-      printf("├ time zone offset change announced\n");
-    } else {
-      printf("├ no time zone offset change announced\n");
+  std::condition_variable _stop{};
+
+  bool _stopping{false};
+
+  std::thread _thread{};
+
+  void run() {
+    std::unique_lock<std::mutex> lock{_mutex};
+
+    while (not _stop.wait_for(lock, std::chrono::seconds(_periodSeconds), [this]() { return _stopping; })) {
+      printStatistics(_statisticsGetter());
     }
+  }
+};
 
-    if (timeDetails.first.leapSecondAnnounced) {
-      if (timeDetails.first.leapSecondPositive) {
-        printf("├ positive leap second announced\n");
-      } else {
-        printf("├ negative leap second announced\n");
+std::optional<eczas::DataDecoder::PhaseDiversity> parsePhaseDiversity(const char* name) {
+  if (strcmp(name, "off") == 0) {
+    return eczas::DataDecoder::PhaseDiversity::Off;
+  }
+  if (strcmp(name, "select") == 0) {
+    return eczas::DataDecoder::PhaseDiversity::Selection;
+  }
+  if (strcmp(name, "vote") == 0) {
+    return eczas::DataDecoder::PhaseDiversity::Voting;
+  }
+
+  return {};
+}
+
+void printUsage(const char* appName) {
+  printf("\nUsage: %s [-j threads] [-f format] [-o output] [-s seconds] [-d mode] [-p] [file]\n", appName);
+  printf("  file        recording to be decoded in parallel (stdin stream is decoded when not given)\n");
+  printf("  -j threads  amount of worker threads for recording decoding (default: all CPU cores)\n");
+  printf("  -f format   samples format of input without WAV header: int16 (default), int32, float32, cf32\n");
+  printf("  -o output   output format: text (default), jsonl (JSON Lines), binary (32 byte records)\n");
+  printf("  -s seconds  print stream decoder statistics to stderr every given period (and when decoding ends)\n");
+  printf("  -d mode     time frame extraction across sampling phases: off (default), select (best phase), vote (bit majority of neighbouring phases)\n");
+  printf("  -p          decode stream in a pipeline (reading, decoding and output in separate threads)\n");
+}
+
+int main(int argc, char* argv[]) {
+  const char* recordingPath{nullptr};
+  size_t threadsNo{std::thread::hardware_concurrency()};
+  auto rawSampleFormat{tools::SampleFormat::Int16};
+  auto outputFormat{tools::OutputFormat::Text};
+  auto pipelined{false};
+  uint32_t statisticsPeriodSeconds{0U};
+  auto phaseDiversity{eczas::DataDecoder::PhaseDiversity::Off};
+
+  for (auto argNo{1}; argNo < argc; argNo++) {
+    if ((strcmp(argv[argNo], "-j") == 0) and ((argNo + 1) < argc)) {
+      threadsNo = strtoul(argv[++argNo], nullptr, 10);
+    } else if ((strcmp(argv[argNo], "-f") == 0) and ((argNo + 1) < argc)) {
+      const auto sampleFormatGetter{tools::parseSampleFormat(argv[++argNo])};
+      if (not sampleFormatGetter.has_value()) {
+        printUsage(argv[0]);
+        return 1;
+      }
+      rawSampleFormat = sampleFormatGetter.value();
+    } else if ((strcmp(argv[argNo], "-o") == 0) and ((argNo + 1) < argc)) {
+      const auto outputFormatGetter{tools::parseOutputFormat(argv[++argNo])};
+      if (not outputFormatGetter.has_value()) {
+        printUsage(argv[0]);
+        return 1;
+      }
+      outputFormat = outputFormatGetter.value();
+    } else if ((strcmp(argv[argNo], "-s") == 0) and ((argNo + 1) < argc)) {
+      statisticsPeriodSeconds = static_cast<uint32_t>(strtoul(argv[++argNo], nullptr, 10));
+    } else if ((strcmp(argv[argNo], "-d") == 0) and ((argNo + 1) < argc)) {
+      const auto phaseDiversityGetter{parsePhaseDiversity(argv[++argNo])};
+      if (not phaseDiversityGetter.has_value()) {
+        printUsage(argv[0]);
+        return 1;
       }
+      phaseDiversity = phaseDiversityGetter.value();
+    } else if (strcmp(argv[argNo], "-p") == 0) {
+      pipelined = true;
+    } else if ((argv[argNo][0] != '-') and (recordingPath == nullptr)) {
+      recordingPath = argv[argNo];
     } else {
-      printf("├ no leap second announced\n");
+      printUsage(argv[0]);
+      return 1;
     }
+  }
+
+#ifdef ECZAS_TRACING
+  // latency histograms are printed when the program ends and on SIGUSR1 (i.e. `kill -USR1 <pid>`)
+  atexit([]() { eczas::tracing::dump(STDERR_FILENO); });
+  signal(SIGUSR1, [](int) { eczas::tracing::dump(STDERR_FILENO); });
+#endif
+
+  // all the output goes through the writer's buffer (it's written out once a block of samples is processed)
+  tools::RecordWriter writer{outputFormat, STDOUT_FILENO, DETAILED_OUTPUT};
+
+  writer.writeMessage("\ne-CzasPL Radio C++ reference data decoder by SP6HFE\n");
 
-    switch (timeDetails.first.transmitterState) {
-      case eczas::DataDecoder::TransmitterState::PlannedMaintenance1Day:
-        printf("└ planned transmitter maintenance for 1 day\n");
-        break;
-      case eczas::DataDecoder::TransmitterState::PlannedMaintenance1Week:
-        printf("└ planned transmitter maintenance for 1 week\n");
-        break;
-      case eczas::DataDecoder::TransmitterState::PlannedMaintenanceOver1Week:
-        printf("└ planned transmitter maintenance for over 1 week\n");
-        break;
-      default:
-        printf("└ transmitter working OK\n");
-        break;
+  tools::SampleInput input{};
+  const auto inputError{recordingPath ? input.openFile(recordingPath, rawSampleFormat) : input.openStdin(rawSampleFormat)};
+  if (inputError) {
+    writer.writeMessage("\nE: Can't open input ");
+    writer.writeMessage(recordingPath ? recordingPath : "stdin");
+    writer.writeMessage("\n");
+    return 1;
+  }
+
+  if (recordingPath and input.isMapped()) {
+    // recording is decoded in parallel chunks so only time data (in sample order) is reported
+    const auto recording{input.getAllSamples().value()};
+    const auto overlapSamplesNo{eczas::ChunkedDecoder::getOverlapSamplesNo(RAW_DATA_SAMPLES_PER_BIT)};
+    const auto chunksNo{((threadsNo == 0U) ? 1U : threadsNo) * CHUNKS_PER_THREAD};
+    auto chunkSamplesNo{(recording.samplesNo + chunksNo - 1U) / chunksNo};
+    if (chunkSamplesNo < (MIN_CHUNK_OVERLAPS_NO * overlapSamplesNo)) {
+      chunkSamplesNo = MIN_CHUNK_OVERLAPS_NO * overlapSamplesNo;
     }
-  }};
 
-  ByteTranslator translator{};
-  eczas::DataDecoder decoder{RAW_DATA_SAMPLES_PER_BIT};
+    const eczas::ChunkedDecoder chunkedDecoder{RAW_DATA_SAMPLES_PER_BIT, threadsNo, chunkSamplesNo, phaseDiversity};
+    const auto result{chunkedDecoder.decode(recording.samples, recording.samplesNo)};
 
-#ifdef DEBUG
-  decoder.registerRawTimeFrameCallback(handleRawTimeFrameData);
-  decoder.registerRsProcessedTimeFrameCallback(handleReedSolomonProcessedTimeFrameData);
-  decoder.registerCrcProcessedTimeFrameCallback(handleCrcProcessedTimeFrameData);
-#endif
+    for (const auto& record : result.timeData) {
+      writer.writeTimeData(record.timeData, record.sampleNo);
+    }
+
+    if (result.overrunsNo) {
+      writer.writeCounter(tools::RecordWriter::RecordType::StreamBufferFull, result.overrunsNo);
+    }
 
-  decoder.registerTimeFrameProcessingErrorCallback(handleTimeFrameProcessingError);
-  decoder.registerTimeDataCallback(handleTimeData);
+    writer.writeCounter(tools::RecordWriter::RecordType::ProcessedSamples, recording.samplesNo);
+
+    return 0;
+  }
 
-  printf("\ne-CzasPL Radio C++ reference data decoder by SP6HFE\n");
+  if (pipelined) {
+    // slow output never holds decoding (events it can't keep up with are dropped and counted)
+    eczas::StreamPipeline::Config config{};
+    config.streamSamplesPerBit = RAW_DATA_SAMPLES_PER_BIT;
+    config.timeFramesReported = DETAILED_OUTPUT;
+    config.phaseDiversity = phaseDiversity;
 
-  uint32_t sampleNo{0U};
+    eczas::StreamPipeline pipeline{config};
+    std::optional<StatisticsMonitor> monitor{};
+    monitor.emplace(statisticsPeriodSeconds, [&]() { return pipeline.getDecoderStatistics(); });
 
-  for (;;) {
-    const auto& result{std::cin.read(&translator.bytes[0], 2U)};
-    if (not result.good()) {
-      break;
+    const auto result{pipeline.run(input, [&](const eczas::StreamPipeline::Event& event) {
+      switch (event.type) {
+        case eczas::StreamPipeline::EventType::RawTimeFrame:
+          writer.writeTimeFrame(tools::RecordWriter::RecordType::RawTimeFrame, event.timeFrame, event.sampleNo);
+          break;
+        case eczas::StreamPipeline::EventType::RsProcessedTimeFrame:
+          writer.writeTimeFrame(tools::RecordWriter::RecordType::RsProcessedTimeFrame, event.timeFrame, event.sampleNo);
+          break;
+        case eczas::StreamPipeline::EventType::CrcProcessedTimeFrame:
+          writer.writeTimeFrame(tools::RecordWriter::RecordType::CrcProcessedTimeFrame, event.timeFrame, event.sampleNo);
+          break;
+        case eczas::StreamPipeline::EventType::TimeData:
+          writer.writeTimeData(event.timeData, event.sampleNo);
+          break;
+        case eczas::StreamPipeline::EventType::TimeFrameProcessingError:
+          writer.writeTimeFrameProcessingError(event.error);
+          break;
+        case eczas::StreamPipeline::EventType::StreamBufferFull:
+          writer.writeCounter(tools::RecordWriter::RecordType::StreamBufferFull, event.overrunsNo);
+          break;
+        case eczas::StreamPipeline::EventType::OutputIdle:
+          writer.flush();
+          break;
+        default:
+          break;
+      }
+    })};
+    monitor.reset();
+
+    if (result.droppedSamplesNo) {
+      writer.writeCounter(tools::RecordWriter::RecordType::SamplesDropped, result.droppedSamplesNo);
     }
 
-    const auto bufferFull{decoder.processNewSample(translator.uint16)};
-    if (bufferFull) {
-      printf("\nE: Stream buffer full");
+    if (result.droppedEventsNo) {
+      writer.writeCounter(tools::RecordWriter::RecordType::EventsDropped, result.droppedEventsNo);
     }
 
-    sampleNo++;
+    writer.writeCounter(tools::RecordWriter::RecordType::ProcessedSamples, result.samplesNo);
+
+    return 0;
   }
 
-  printf("\nProcessed %d samples.\n", --sampleNo);
+  // stream (or recording which can't be mapped) is decoded block by block
+  eczas::DataDecoder decoder{RAW_DATA_SAMPLES_PER_BIT};
+  decoder.setPhaseDiversity(phaseDiversity);
+
+  if (DETAILED_OUTPUT) {
+    decoder.registerRawTimeFrameCallback([&](std::pair<const eczas::DataDecoder::TimeFrame&, uint64_t> frameDetails) {
+      writer.writeTimeFrame(tools::RecordWriter::RecordType::RawTimeFrame, frameDetails.first, frameDetails.second);
+    });
+    decoder.registerRsProcessedTimeFrameCallback([&](std::pair<const eczas::DataDecoder::TimeFrame&, uint64_t> frameDetails) {
+      writer.writeTimeFrame(tools::RecordWriter::RecordType::RsProcessedTimeFrame, frameDetails.first, frameDetails.second);
+    });
+    decoder.registerCrcProcessedTimeFrameCallback([&](std::pair<const eczas::DataDecoder::TimeFrame&, uint64_t> frameDetails) {
+      writer.writeTimeFrame(tools::RecordWriter::RecordType::CrcProcessedTimeFrame, frameDetails.first, frameDetails.second);
+    });
+  }
+
+  decoder.registerTimeFrameProcessingErrorCallback([&](eczas::DataDecoder::TimeFrameProcessingError error) {
+    writer.writeTimeFrameProcessingError(error);
+  });
+  decoder.registerTimeDataCallback([&](std::pair<const eczas::DataDecoder::TimeData&, uint64_t> timeDetails) {
+    writer.writeTimeData(timeDetails.first, timeDetails.second);
+  });
+
+  size_t samplesNo{0U};
+  std::optional<StatisticsMonitor> monitor{};
+  monitor.emplace(statisticsPeriodSeconds, [&]() { return decoder.getStatistics(); });
+
+  for (auto block{input.getNextBlock()}; block.has_value(); block = input.getNextBlock()) {
+    const auto result{decoder.processSamples(block->samples, block->samplesNo)};
+    if (result.overrunsNo) {
+      writer.writeCounter(tools::RecordWriter::RecordType::StreamBufferFull, result.overrunsNo);
+    }
+
+    samplesNo += result.samplesNo;
+
+    // live stream results are not held until the buffer gets full
+    writer.flush();
+  }
+  monitor.reset();
+
+  writer.writeCounter(tools::RecordWriter::RecordType::ProcessedSamples, samplesNo);
 
   return 0;
-}
\ No newline at end of file
+}